@@ -26,6 +26,8 @@ int main() {
     // 3. Longitud de std::string
     // -------------------------------
     // std::string::length() devuelve size_t (unsigned)
+    // Ojo: length() cuenta bytes, no caracteres. En UTF-8 "José" ocupa 5 bytes.
+    // Para contar caracteres ver Ejercicios/strings/exercise_7 (utf8::codePointCount).
     int nameLength = static_cast<int>(fullName.length()); 
     int total = age + nameLength;
 
@@ -1,5 +1,10 @@
 #include "Three_numbers.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#define THREE_NUMBERS_X86 1
+#include <immintrin.h>
+#endif
+
 ThreeNumbers::ThreeNumbers(int num1, int num2, int num3) 
     : number1(num1), number2(num2), number3(num3) {}
 
@@ -10,3 +15,51 @@ int ThreeNumbers::findLargest() const {
     if (number3 > max) max = number3;
     return max;
 }
+
+namespace {
+
+// ----------------------------
+// Columna a columna
+// ----------------------------
+void findLargestScalar(const int* number1, const int* number2, const int* number3, std::size_t first,
+                       std::size_t count, int* largest) {
+    for (std::size_t i = first; i < count; ++i) {
+        int max = number1[i];
+        max = number2[i] > max ? number2[i] : max;
+        max = number3[i] > max ? number3[i] : max;
+        largest[i] = max;
+    }
+}
+
+#ifdef THREE_NUMBERS_X86
+__attribute__((target("avx2"))) void findLargestAvx2(const int* number1, const int* number2, const int* number3,
+                                                     std::size_t count, int* largest) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(number1 + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(number2 + i));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(number3 + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(largest + i), _mm256_max_epi32(_mm256_max_epi32(a, b), c));
+    }
+    findLargestScalar(number1, number2, number3, i, count, largest);
+}
+#endif
+
+} // namespace
+
+void ThreeNumbers::findLargest(const int* number1, const int* number2, const int* number3, std::size_t count,
+                               int* largest) {
+#ifdef THREE_NUMBERS_X86
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    if (hasAvx2) {
+        findLargestAvx2(number1, number2, number3, count, largest);
+        return;
+    }
+#endif
+    findLargestScalar(number1, number2, number3, 0, count, largest);
+}
+
+void ThreeNumbers::findLargest(const SoaVector<int, int, int>& triples, int* largest) {
+    findLargest(triples.column<0>().data(), triples.column<1>().data(), triples.column<2>().data(), triples.size(),
+                largest);
+}
@@ -1,6 +1,9 @@
 #ifndef THREE_NUMBERS_H
 #define THREE_NUMBERS_H
 
+#include <cstddef>
+#include "soa_vector.h"
+
 /**
  * @class ThreeNumbers
  * @brief Representa tres números enteros y permite determinar el mayor.
@@ -28,6 +31,19 @@ public:
      * @return El número más grande.
      */
     int findLargest() const;
+
+    /**
+     * @brief El mayor de cada trío, columna a columna.
+     *
+     * largest[i] es el mayor de number1[i], number2[i] y number3[i]. Cada
+     * columna se lee de forma contigua y, con AVX2, se procesan 8 tríos por
+     * instrucción.
+     */
+    static void findLargest(const int* number1, const int* number2, const int* number3, std::size_t count,
+                            int* largest);
+
+    /// Igual, con los tríos en un SoaVector (una columna por número). largest debe tener sitio para todos.
+    static void findLargest(const SoaVector<int, int, int>& triples, int* largest);
 };
 
 #endif 
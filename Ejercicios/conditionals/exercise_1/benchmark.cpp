@@ -0,0 +1,574 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if __has_include(<execution>)
+#include <execution>
+#include <numeric>
+#define BENCHMARK_HAS_STD_PAR 1
+#endif
+#include "Three_numbers.h"
+#include "max_reduce.h"
+#include "parallel_reduce.h"
+#include "soa_vector.h"
+#include "sorting_network.h"
+#include "stream_stats.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// ----------------------------
+// Benchmark: el mayor de N elementos
+// ----------------------------
+// Para cada tipo, un array de M MB (64 por defecto) con valores aleatorios
+// y el máximo en una posición al azar. Se compara std::max_element con
+// maxValue y argMax de cada kernel, en millones de elementos por segundo
+// (mejor de 3). Todos deben encontrar la misma posición.
+//
+// Después, escalado con hilos: un array de int32_t de P MB (256 por defecto)
+// reducido con parallel_reduce (máximo, mínimo, suma e histograma) con 1, 2,
+// 4... hasta todos los núcleos, en GB/s, frente a std::reduce con
+// std::execution::par (que usa siempre todos los núcleos).
+//
+// Por último, redes de ordenación: 2^18 grupos de N int32_t (N de 3 a 32)
+// ordenados y con su mediana calculada con std::sort, std::nth_element y
+// sorting_network, en millones de grupos por segundo.
+//
+// Y AoS frente a SoA: 2^23 tríos de int como vector de structs y como
+// SoaVector<int, int, int>, recorriendo un solo campo, el registro entero
+// (ThreeNumbers::findLargest) y registros al azar. Además del tiempo por
+// registro, fallos de caché L1d y de último nivel por registro si el kernel
+// deja leer los contadores (perf_event_open); si no, "n/d".
+//
+// Al final, estadísticas de un flujo de 2^25 int32_t (ventana de 1024, los
+// 100 mayores): millones de valores por segundo con push uno a uno y con
+// pushBatch por bloques de 4096, y latencia de cada push en ciclos.
+
+namespace {
+
+volatile std::size_t sink{};
+
+template <typename F>
+double bestSeconds(F&& body) {
+    double best{1e30};
+    for (int run = 0; run < 3; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void report(const std::string& name, std::size_t count, double seconds, bool same) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(10) << count / seconds / 1e6 << " M/s" << (same ? "" : "   ¡POSICIÓN DISTINTA!") << '\n';
+}
+
+template <typename T>
+void benchmarkType(const char* typeName, std::size_t megabytes, std::mt19937& rng) {
+    const std::size_t count = (megabytes << 20) / sizeof(T);
+    std::vector<T> values(count);
+    std::uniform_int_distribution<int> small{-100, 100};
+    for (T& value : values) value = static_cast<T>(small(rng));
+    const std::size_t position = rng() % count;
+    values[position] = static_cast<T>(120);
+
+    std::cout << typeName << " (" << count << " elementos)\n";
+    std::size_t expected{};
+    const double stdSeconds = bestSeconds([&] {
+        expected = static_cast<std::size_t>(std::max_element(values.begin(), values.end()) - values.begin());
+        sink = expected;
+    });
+    report("std::max_element", count, stdSeconds, expected == position);
+
+    for (const max_reduce::Kernel kernel :
+         {max_reduce::Kernel::Scalar, max_reduce::Kernel::Avx2, max_reduce::Kernel::Avx512}) {
+        if (!max_reduce::forceKernel(kernel)) continue;
+        const std::string name = max_reduce::kernelName(kernel);
+        T largest{};
+        const double valueSeconds = bestSeconds([&] {
+            largest = max_reduce::maxValue(values);
+            sink = static_cast<std::size_t>(largest);
+        });
+        report("maxValue " + name, count, valueSeconds, largest == values[position]);
+        std::size_t index{};
+        const double indexSeconds = bestSeconds([&] {
+            index = max_reduce::argMax(values);
+            sink = index;
+        });
+        report("argMax " + name, count, indexSeconds, index == position);
+    }
+}
+
+// ----------------------------
+// Escalado con hilos
+// ----------------------------
+using Histogram = std::array<std::uint64_t, 256>;
+
+Histogram addHistograms(Histogram a, const Histogram& b) {
+    for (std::size_t bucket = 0; bucket < a.size(); ++bucket) a[bucket] += b[bucket];
+    return a;
+}
+
+void reportRate(const std::string& name, std::size_t bytes, double seconds, bool same) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << bytes / seconds / 1e9 << " GB/s" << (same ? "" : "   ¡RESULTADO DISTINTO!") << '\n';
+}
+
+void benchmarkScaling(std::size_t megabytes, std::mt19937& rng) {
+    const std::size_t count = (megabytes << 20) / sizeof(std::int32_t);
+    const std::size_t bytes = count * sizeof(std::int32_t);
+    std::vector<std::int32_t> values(count);
+    std::uniform_int_distribution<std::int32_t> any{-1'000'000, 1'000'000};
+    for (std::int32_t& value : values) value = any(rng);
+    const std::int32_t* data = values.data();
+
+    const std::int32_t expectedMax = *std::max_element(values.begin(), values.end());
+    const std::int32_t expectedMin = *std::min_element(values.begin(), values.end());
+    std::int64_t expectedSum{};
+    Histogram expectedHistogram{};
+    for (const std::int32_t value : values) {
+        expectedSum += value;
+        ++expectedHistogram[static_cast<std::uint8_t>(value)];
+    }
+
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "Escalado int32_t (" << count << " elementos, " << cores << " núcleos)\n";
+    for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+        WorkStealingPool pool{threads};
+        std::cout << " " << threads << (threads == 1 ? " hilo\n" : " hilos\n");
+
+        std::int32_t largest{};
+        double seconds = bestSeconds([&] { largest = parallel_reduce::maxValue(pool, values); });
+        reportRate("max", bytes, seconds, largest == expectedMax);
+
+        std::int32_t smallest{};
+        seconds = bestSeconds([&] {
+            smallest = parallel_reduce::reduce(
+                pool, data, count, std::numeric_limits<std::int32_t>::max(),
+                [](const std::int32_t* first, std::size_t n) { return *std::min_element(first, first + n); },
+                [](std::int32_t a, std::int32_t b) { return std::min(a, b); });
+        });
+        reportRate("min", bytes, seconds, smallest == expectedMin);
+
+        std::int64_t sum{};
+        seconds = bestSeconds([&] {
+            sum = parallel_reduce::reduce(
+                pool, data, count, std::int64_t{0},
+                [](const std::int32_t* first, std::size_t n) {
+                    std::int64_t partial{};
+                    for (std::size_t i = 0; i < n; ++i) partial += first[i];
+                    return partial;
+                },
+                [](std::int64_t a, std::int64_t b) { return a + b; });
+        });
+        reportRate("suma", bytes, seconds, sum == expectedSum);
+
+        Histogram histogram{};
+        seconds = bestSeconds([&] {
+            histogram = parallel_reduce::reduce(
+                pool, data, count, Histogram{},
+                [](const std::int32_t* first, std::size_t n) {
+                    Histogram partial{};
+                    for (std::size_t i = 0; i < n; ++i) ++partial[static_cast<std::uint8_t>(first[i])];
+                    return partial;
+                },
+                addHistograms);
+        });
+        reportRate("histograma", bytes, seconds, histogram == expectedHistogram);
+        sink = static_cast<std::size_t>(largest + smallest + sum) + histogram[0];
+
+        if (threads == cores) break;
+    }
+
+#ifdef BENCHMARK_HAS_STD_PAR
+    std::cout << " std::execution::par\n";
+    std::int32_t largest{};
+    double seconds = bestSeconds([&] {
+        largest = std::reduce(std::execution::par, values.begin(), values.end(),
+                              std::numeric_limits<std::int32_t>::min(),
+                              [](std::int32_t a, std::int32_t b) { return std::max(a, b); });
+    });
+    reportRate("std::reduce max", bytes, seconds, largest == expectedMax);
+    std::int64_t sum{};
+    seconds = bestSeconds(
+        [&] { sum = std::reduce(std::execution::par, values.begin(), values.end(), std::int64_t{0}); });
+    reportRate("std::reduce suma", bytes, seconds, sum == expectedSum);
+    sink = static_cast<std::size_t>(largest + sum);
+#endif
+}
+
+// ----------------------------
+// Redes de ordenación
+// ----------------------------
+// Cada método lee los grupos de input y escribe su resultado en otro array,
+// así que todas las pasadas parten de los mismos datos desordenados.
+void reportGroups(const std::string& name, std::size_t groups, double seconds, bool same) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << groups / seconds / 1e6 << " M grupos/s" << (same ? "" : "   ¡RESULTADO DISTINTO!")
+              << '\n';
+}
+
+template <std::size_t N>
+void benchmarkNetwork(std::size_t groups, std::mt19937& rng) {
+    using T = std::int32_t;
+    std::vector<T> grouped(N * groups); // grupo g en [g * N, g * N + N)
+    std::uniform_int_distribution<T> any{-1'000'000, 1'000'000};
+    for (T& value : grouped) value = any(rng);
+    std::vector<T> transposed(N * groups); // elemento i del grupo g en i * groups + g
+    for (std::size_t g = 0; g < groups; ++g) {
+        for (std::size_t i = 0; i < N; ++i) transposed[i * groups + g] = grouped[g * N + i];
+    }
+
+    std::vector<T> expectedSorted = grouped;
+    std::vector<T> expectedMedian(groups);
+    for (std::size_t g = 0; g < groups; ++g) {
+        std::sort(expectedSorted.begin() + g * N, expectedSorted.begin() + g * N + N);
+        expectedMedian[g] = expectedSorted[g * N + (N - 1) / 2];
+    }
+    auto sameTransposed = [&](const std::vector<T>& sorted) {
+        for (std::size_t g = 0; g < groups; ++g) {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (sorted[i * groups + g] != expectedSorted[g * N + i]) return false;
+            }
+        }
+        return true;
+    };
+
+    std::cout << "Redes de ordenación, N = " << N << " (" << sorting_network::SortingNetwork<N>::size
+              << " comparaciones; mediana " << sorting_network::SelectionNetwork<N, (N - 1) / 2>::size << ")\n";
+    std::vector<T> sorted(N * groups);
+    std::vector<T> medians(groups);
+
+    double seconds = bestSeconds([&] {
+        std::copy(grouped.begin(), grouped.end(), sorted.begin());
+        for (std::size_t g = 0; g < groups; ++g) std::sort(sorted.begin() + g * N, sorted.begin() + g * N + N);
+    });
+    reportGroups("std::sort", groups, seconds, sorted == expectedSorted);
+
+    seconds = bestSeconds([&] {
+        std::copy(grouped.begin(), grouped.end(), sorted.begin());
+        for (std::size_t g = 0; g < groups; ++g) sorting_network::sort<N>(sorted.data() + g * N);
+    });
+    reportGroups("sort<N>", groups, seconds, sorted == expectedSorted);
+
+    seconds = bestSeconds([&] {
+        for (std::size_t g = 0; g < groups; ++g) {
+            T group[N];
+            std::copy(grouped.begin() + g * N, grouped.begin() + g * N + N, group);
+            std::nth_element(group, group + (N - 1) / 2, group + N);
+            medians[g] = group[(N - 1) / 2];
+        }
+    });
+    reportGroups("std::nth_element", groups, seconds, medians == expectedMedian);
+
+    seconds = bestSeconds([&] {
+        for (std::size_t g = 0; g < groups; ++g) medians[g] = sorting_network::median<N>(grouped.data() + g * N);
+    });
+    reportGroups("median<N>", groups, seconds, medians == expectedMedian);
+
+    for (const sorting_network::Kernel kernel : {sorting_network::Kernel::Scalar, sorting_network::Kernel::Avx2}) {
+        if (!sorting_network::forceKernel(kernel)) continue;
+        const std::string name = sorting_network::kernelName(kernel);
+        seconds = bestSeconds([&] { sorting_network::sortTransposed<N>(transposed.data(), groups, sorted.data()); });
+        reportGroups("sortTransposed " + name, groups, seconds, sameTransposed(sorted));
+        seconds = bestSeconds(
+            [&] { sorting_network::medianTransposed<N>(transposed.data(), groups, medians.data()); });
+        reportGroups("medianTransposed " + name, groups, seconds, medians == expectedMedian);
+    }
+    sink = static_cast<std::size_t>(sorted[0] + medians[0]);
+}
+
+// ----------------------------
+// AoS frente a SoA
+// ----------------------------
+// Contadores de fallos de caché del hilo actual, solo en modo usuario.
+class CacheMisses {
+public:
+    CacheMisses() {
+#ifdef __linux__
+        l1d_ = open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                                            PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        lastLevel_ = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+    }
+
+    ~CacheMisses() {
+#ifdef __linux__
+        if (l1d_ >= 0) close(l1d_);
+        if (lastLevel_ >= 0) close(lastLevel_);
+#endif
+    }
+
+    CacheMisses(const CacheMisses&) = delete;
+    CacheMisses& operator=(const CacheMisses&) = delete;
+
+    /// Ejecuta body una vez y devuelve {fallos L1d, fallos de último nivel}; -1 si no hay contador.
+    template <typename F>
+    std::pair<long long, long long> count(F&& body) {
+        control(PERF_EVENT_IOC_RESET);
+        control(PERF_EVENT_IOC_ENABLE);
+        body();
+        control(PERF_EVENT_IOC_DISABLE);
+        return {read(l1d_), read(lastLevel_)};
+    }
+
+private:
+#ifdef __linux__
+    static int open(std::uint32_t type, std::uint64_t config) {
+        perf_event_attr attributes{};
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    void control(unsigned long request) {
+        if (l1d_ >= 0) ioctl(l1d_, request, 0);
+        if (lastLevel_ >= 0) ioctl(lastLevel_, request, 0);
+    }
+
+    static long long read(int fd) {
+        std::uint64_t value{};
+        if (fd < 0 || ::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) return -1;
+        return static_cast<long long>(value);
+    }
+#else
+    void control(unsigned long) { }
+    static long long read(int) { return -1; }
+#endif
+
+    int l1d_{-1};
+    int lastLevel_{-1};
+};
+
+struct Triple {
+    int number1;
+    int number2;
+    int number3;
+};
+
+template <typename F>
+void reportRecords(const std::string& name, std::size_t records, CacheMisses& misses, F&& body) {
+    const double seconds = bestSeconds(body);
+    const auto [l1d, lastLevel] = misses.count(body);
+    auto perRecord = [&](long long events) {
+        if (events < 0) return std::string{"n/d"};
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(3) << static_cast<double>(events) / records;
+        return text.str();
+    };
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(8) << seconds / records * 1e9 << " ns/registro   L1d " << std::setw(6) << perRecord(l1d)
+              << "   LLC " << std::setw(6) << perRecord(lastLevel) << '\n';
+}
+
+void benchmarkSoa(std::size_t records, std::mt19937& rng) {
+    std::vector<Triple> aos(records);
+    SoaVector<int, int, int> soa;
+    soa.reserve(records);
+    std::uniform_int_distribution<int> any{-1'000'000, 1'000'000};
+    for (Triple& triple : aos) {
+        triple = Triple{any(rng), any(rng), any(rng)};
+        soa.push_back(triple.number1, triple.number2, triple.number3);
+    }
+    std::vector<std::uint32_t> order(records);
+    for (std::uint32_t& index : order) index = static_cast<std::uint32_t>(rng() % records);
+
+    CacheMisses misses;
+    std::cout << "AoS frente a SoA (" << records << " tríos de int)\n";
+
+    long long expected{};
+    for (const Triple& triple : aos) expected += triple.number1;
+    long long sum{};
+    reportRecords("number1 AoS", records, misses, [&] {
+        sum = 0;
+        for (const Triple& triple : aos) sum += triple.number1;
+    });
+    bool sameSum = sum == expected;
+    reportRecords("number1 SoA", records, misses, [&] {
+        sum = 0;
+        for (const int value : soa.column<0>()) sum += value;
+    });
+    sameSum = sameSum && sum == expected;
+
+    std::vector<int> largest(records);
+    std::vector<int> expectedLargest(records);
+    reportRecords("findLargest AoS", records, misses, [&] {
+        for (std::size_t i = 0; i < records; ++i) {
+            const Triple& triple = aos[i];
+            expectedLargest[i] = ThreeNumbers{triple.number1, triple.number2, triple.number3}.findLargest();
+        }
+    });
+    reportRecords("findLargest SoA iterador", records, misses, [&] {
+        int* out = largest.data();
+        for (const auto [number1, number2, number3] : soa) {
+            *out++ = ThreeNumbers{number1, number2, number3}.findLargest();
+        }
+    });
+    const bool sameIterated = largest == expectedLargest;
+    std::fill(largest.begin(), largest.end(), 0);
+    reportRecords("findLargest SoA columnas", records, misses,
+                  [&] { ThreeNumbers::findLargest(soa, largest.data()); });
+    const bool sameColumns = largest == expectedLargest;
+
+    long long randomExpected{};
+    for (const std::uint32_t index : order) {
+        randomExpected += aos[index].number1 + aos[index].number2 + aos[index].number3;
+    }
+    long long randomSum{};
+    reportRecords("al azar AoS", records, misses, [&] {
+        randomSum = 0;
+        for (const std::uint32_t index : order) {
+            const Triple& triple = aos[index];
+            randomSum += triple.number1 + triple.number2 + triple.number3;
+        }
+    });
+    const bool sameRandomAos = randomSum == randomExpected;
+    reportRecords("al azar SoA", records, misses, [&] {
+        randomSum = 0;
+        for (const std::uint32_t index : order) {
+            const auto [number1, number2, number3] = soa[index];
+            randomSum += number1 + number2 + number3;
+        }
+    });
+    const bool sameRandomSoa = randomSum == randomExpected;
+
+    if (!(sameSum && sameIterated && sameColumns && sameRandomAos && sameRandomSoa)) {
+        std::cout << "  ¡RESULTADO DISTINTO!\n";
+    }
+    sink = static_cast<std::size_t>(sum + randomSum) + static_cast<std::size_t>(largest[0]);
+}
+
+// ----------------------------
+// Estadísticas de un flujo
+// ----------------------------
+std::uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+void reportStream(const std::string& name, std::size_t count, double seconds) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << count / seconds / 1e6 << " M/s" << std::setprecision(2) << std::setw(10)
+              << seconds / count * 1e9 << " ns/valor\n";
+}
+
+// Uno a uno y por bloques, siempre con un objeto nuevo para que las tres
+// pasadas vean el flujo desde el principio. result evita que el compilador
+// se salte el trabajo.
+template <typename Make, typename Result>
+void benchmarkStreamKind(const std::string& name, const std::vector<std::int32_t>& values, Make make,
+                         Result result) {
+    constexpr std::size_t block = 4096;
+    double seconds = bestSeconds([&] {
+        auto stats = make();
+        for (const std::int32_t value : values) stats.push(value);
+        sink = static_cast<std::size_t>(result(stats));
+    });
+    reportStream(name + " push", values.size(), seconds);
+    seconds = bestSeconds([&] {
+        auto stats = make();
+        for (std::size_t first = 0; first < values.size(); first += block) {
+            stats.pushBatch(values.data() + first, std::min(block, values.size() - first));
+        }
+        sink = static_cast<std::size_t>(result(stats));
+    });
+    reportStream(name + " pushBatch", values.size(), seconds);
+}
+
+void benchmarkStream(std::size_t count, std::mt19937& rng) {
+    constexpr std::size_t window = 1024;
+    constexpr std::size_t k = 100;
+    std::vector<std::int32_t> values(count);
+    std::uniform_int_distribution<std::int32_t> any{-1'000'000'000, 1'000'000'000};
+    for (std::int32_t& value : values) value = any(rng);
+
+    std::cout << "Flujo de " << count << " int32_t (ventana " << window << ", top " << k << ")\n";
+    auto largest = [](const auto& stats) { return stats.max().value_or(0); };
+    benchmarkStreamKind(
+        "RunningMax", values, [] { return stream_stats::RunningMax<std::int32_t>{}; }, largest);
+    benchmarkStreamKind(
+        "SlidingMax", values, [] { return stream_stats::SlidingMax<std::int32_t>{window}; }, largest);
+    benchmarkStreamKind(
+        "TopK", values, [] { return stream_stats::TopK<std::int32_t>{k}; },
+        [](const auto& stats) { return stats.threshold().value_or(0); });
+    benchmarkStreamKind(
+        "StreamStats", values, [] { return stream_stats::StreamStats<std::int32_t>{window, k}; },
+        [](const auto& stats) { return stats.windowMax().value_or(0) + stats.topK().back(); });
+
+    // Mismos resultados por las dos vías.
+    stream_stats::StreamStats<std::int32_t> one{window, k};
+    stream_stats::StreamStats<std::int32_t> batched{window, k};
+    for (const std::int32_t value : values) one.push(value);
+    batched.pushBatch(values.data(), values.size());
+    if (one.max() != batched.max() || one.windowMax() != batched.windowMax() || one.topK() != batched.topK()) {
+        std::cout << "  ¡RESULTADO DISTINTO!\n";
+    }
+
+    // Latencia de cada push (incluye lo que cuesta leer el contador).
+    const std::size_t samples = std::min<std::size_t>(count, std::size_t{1} << 22);
+    std::vector<std::uint64_t> latencies(samples);
+    stream_stats::StreamStats<std::int32_t> stats{window, k};
+    for (std::size_t i = 0; i < samples; ++i) {
+        const std::uint64_t start = cycles();
+        stats.push(values[i]);
+        latencies[i] = cycles() - start;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) { return latencies[static_cast<std::size_t>(p * (samples - 1))]; };
+    std::cout << "  StreamStats push, ciclos: p50 " << percentile(0.5) << "   p99 " << percentile(0.99)
+              << "   p99.9 " << percentile(0.999) << "   máx " << latencies.back() << '\n';
+    sink = static_cast<std::size_t>(stats.count());
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t megabytes = 64;
+    if (argc > 1) megabytes = std::strtoull(argv[1], nullptr, 10);
+    std::size_t scalingMegabytes = 256;
+    if (argc > 2) scalingMegabytes = std::strtoull(argv[2], nullptr, 10);
+
+    std::mt19937 rng{19};
+    benchmarkType<std::int8_t>("int8_t", megabytes, rng);
+    benchmarkType<std::int16_t>("int16_t", megabytes, rng);
+    benchmarkType<std::int32_t>("int32_t", megabytes, rng);
+    benchmarkType<std::int64_t>("int64_t", megabytes, rng);
+    benchmarkType<float>("float", megabytes, rng);
+    benchmarkType<double>("double", megabytes, rng);
+    benchmarkScaling(scalingMegabytes, rng);
+
+    constexpr std::size_t groups = std::size_t{1} << 18;
+    benchmarkNetwork<3>(groups, rng);
+    benchmarkNetwork<5>(groups, rng);
+    benchmarkNetwork<9>(groups, rng);
+    benchmarkNetwork<16>(groups, rng);
+    benchmarkNetwork<25>(groups, rng);
+    benchmarkNetwork<32>(groups, rng);
+
+    benchmarkSoa(std::size_t{1} << 23, rng);
+    benchmarkStream(std::size_t{1} << 25, rng);
+    return 0;
+}
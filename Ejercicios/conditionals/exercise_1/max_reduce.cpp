@@ -0,0 +1,400 @@
+#include "max_reduce.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MAX_REDUCE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace max_reduce {
+
+namespace {
+
+// Valor inicial del acumulador: cualquier número lo supera o lo iguala.
+template <typename T>
+constexpr T identity() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return -std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::min();
+    }
+}
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+// x > best es falso si x es NaN, así que los NaN se ignoran sin comprobarlo.
+template <typename T>
+T maxFrom(const T* data, std::size_t count, T best) {
+    for (std::size_t i = 0; i < count; ++i) best = data[i] > best ? data[i] : best;
+    return best;
+}
+
+template <typename T>
+T maxScalar(const T* data, std::size_t count) {
+    return maxFrom(data, count, identity<T>());
+}
+
+// Posición del primer elemento igual a value, o count.
+template <typename T>
+std::size_t findScalar(const T* data, std::size_t count, T value) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (data[i] == value) return i;
+    }
+    return count;
+}
+
+#ifdef MAX_REDUCE_X86
+
+// ----------------------------
+// Operaciones AVX2 por tipo
+// ----------------------------
+// Cada Ops da: V (el registro), lanes, load, set1, max(datos, acumulador),
+// store y equal (máscara de bits con bitsPerLane bits por carril).
+// Para float y double, _mm256_max_ps(a, b) devuelve b si alguno es NaN: con
+// los datos en a, un NaN deja el acumulador como estaba.
+#define MAX_REDUCE_AVX2 __attribute__((target("avx2"), always_inline)) static inline
+
+template <typename T>
+struct Avx2Ops;
+
+template <typename T, int BitsPerLane>
+struct Avx2IntegerOps {
+    using V = __m256i;
+    static constexpr std::size_t lanes = 32 / sizeof(T);
+    static constexpr int bitsPerLane = BitsPerLane;
+    MAX_REDUCE_AVX2 V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    MAX_REDUCE_AVX2 void store(T* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+template <>
+struct Avx2Ops<std::int8_t> : Avx2IntegerOps<std::int8_t, 1> {
+    MAX_REDUCE_AVX2 V set1(std::int8_t value) { return _mm256_set1_epi8(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_max_epi8(a, b); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    }
+};
+
+template <>
+struct Avx2Ops<std::int16_t> : Avx2IntegerOps<std::int16_t, 2> {
+    MAX_REDUCE_AVX2 V set1(std::int16_t value) { return _mm256_set1_epi16(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_max_epi16(a, b); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b)));
+    }
+};
+
+template <>
+struct Avx2Ops<std::int32_t> : Avx2IntegerOps<std::int32_t, 4> {
+    MAX_REDUCE_AVX2 V set1(std::int32_t value) { return _mm256_set1_epi32(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)));
+    }
+};
+
+// AVX2 no tiene máximo de 64 bits: comparación y mezcla.
+template <>
+struct Avx2Ops<std::int64_t> : Avx2IntegerOps<std::int64_t, 8> {
+    MAX_REDUCE_AVX2 V set1(std::int64_t value) { return _mm256_set1_epi64x(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b)));
+    }
+};
+
+template <>
+struct Avx2Ops<float> {
+    using V = __m256;
+    static constexpr std::size_t lanes = 8;
+    static constexpr int bitsPerLane = 1;
+    MAX_REDUCE_AVX2 V load(const float* p) { return _mm256_loadu_ps(p); }
+    MAX_REDUCE_AVX2 void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    MAX_REDUCE_AVX2 V set1(float value) { return _mm256_set1_ps(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_max_ps(a, b); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+};
+
+template <>
+struct Avx2Ops<double> {
+    using V = __m256d;
+    static constexpr std::size_t lanes = 4;
+    static constexpr int bitsPerLane = 1;
+    MAX_REDUCE_AVX2 V load(const double* p) { return _mm256_loadu_pd(p); }
+    MAX_REDUCE_AVX2 void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    MAX_REDUCE_AVX2 V set1(double value) { return _mm256_set1_pd(value); }
+    MAX_REDUCE_AVX2 V max(V a, V b) { return _mm256_max_pd(a, b); }
+    MAX_REDUCE_AVX2 std::uint64_t equal(V a, V b) {
+        return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+};
+
+#undef MAX_REDUCE_AVX2
+
+// ----------------------------
+// Operaciones AVX-512 por tipo
+// ----------------------------
+// Las comparaciones dan directamente una máscara de un bit por carril.
+// GCC 12 avisa de "__Y sin inicializar" dentro de sus propias cabeceras
+// AVX-512 (_mm512_undefined_*): es un falso positivo.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#define MAX_REDUCE_AVX512 __attribute__((target("avx512f,avx512bw"), always_inline)) static inline
+
+template <typename T>
+struct Avx512Ops;
+
+template <typename T>
+struct Avx512IntegerOps {
+    using V = __m512i;
+    static constexpr std::size_t lanes = 64 / sizeof(T);
+    static constexpr int bitsPerLane = 1;
+    MAX_REDUCE_AVX512 V load(const T* p) { return _mm512_loadu_si512(p); }
+    MAX_REDUCE_AVX512 void store(T* p, V v) { _mm512_storeu_si512(p, v); }
+};
+
+template <>
+struct Avx512Ops<std::int8_t> : Avx512IntegerOps<std::int8_t> {
+    MAX_REDUCE_AVX512 V set1(std::int8_t value) { return _mm512_set1_epi8(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_epi8(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmpeq_epi8_mask(a, b); }
+};
+
+template <>
+struct Avx512Ops<std::int16_t> : Avx512IntegerOps<std::int16_t> {
+    MAX_REDUCE_AVX512 V set1(std::int16_t value) { return _mm512_set1_epi16(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_epi16(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmpeq_epi16_mask(a, b); }
+};
+
+template <>
+struct Avx512Ops<std::int32_t> : Avx512IntegerOps<std::int32_t> {
+    MAX_REDUCE_AVX512 V set1(std::int32_t value) { return _mm512_set1_epi32(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_epi32(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmpeq_epi32_mask(a, b); }
+};
+
+template <>
+struct Avx512Ops<std::int64_t> : Avx512IntegerOps<std::int64_t> {
+    MAX_REDUCE_AVX512 V set1(std::int64_t value) { return _mm512_set1_epi64(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_epi64(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmpeq_epi64_mask(a, b); }
+};
+
+template <>
+struct Avx512Ops<float> {
+    using V = __m512;
+    static constexpr std::size_t lanes = 16;
+    static constexpr int bitsPerLane = 1;
+    MAX_REDUCE_AVX512 V load(const float* p) { return _mm512_loadu_ps(p); }
+    MAX_REDUCE_AVX512 void store(float* p, V v) { _mm512_storeu_ps(p, v); }
+    MAX_REDUCE_AVX512 V set1(float value) { return _mm512_set1_ps(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_ps(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+};
+
+template <>
+struct Avx512Ops<double> {
+    using V = __m512d;
+    static constexpr std::size_t lanes = 8;
+    static constexpr int bitsPerLane = 1;
+    MAX_REDUCE_AVX512 V load(const double* p) { return _mm512_loadu_pd(p); }
+    MAX_REDUCE_AVX512 void store(double* p, V v) { _mm512_storeu_pd(p, v); }
+    MAX_REDUCE_AVX512 V set1(double value) { return _mm512_set1_pd(value); }
+    MAX_REDUCE_AVX512 V max(V a, V b) { return _mm512_max_pd(a, b); }
+    MAX_REDUCE_AVX512 std::uint64_t equal(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+};
+
+#undef MAX_REDUCE_AVX512
+
+// ----------------------------
+// Bucles comunes
+// ----------------------------
+// El mismo cuerpo para AVX2 y AVX-512; solo cambia el atributo target (una
+// plantilla no puede llevar los dos). Cuatro acumuladores independientes
+// para que cada max no espere al anterior.
+#define MAX_REDUCE_KERNELS(Name, Target, Ops)                                                       \
+    template <typename T>                                                                          \
+    __attribute__((target(Target))) T max##Name(const T* data, std::size_t count) {                 \
+        using O = Ops<T>;                                                                          \
+        constexpr std::size_t lanes = O::lanes;                                                    \
+        typename O::V acc0 = O::set1(identity<T>());                                               \
+        typename O::V acc1 = acc0;                                                                 \
+        typename O::V acc2 = acc0;                                                                 \
+        typename O::V acc3 = acc0;                                                                 \
+        std::size_t i = 0;                                                                         \
+        for (; i + 4 * lanes <= count; i += 4 * lanes) {                                           \
+            acc0 = O::max(O::load(data + i), acc0);                                                \
+            acc1 = O::max(O::load(data + i + lanes), acc1);                                        \
+            acc2 = O::max(O::load(data + i + 2 * lanes), acc2);                                    \
+            acc3 = O::max(O::load(data + i + 3 * lanes), acc3);                                    \
+        }                                                                                          \
+        for (; i + lanes <= count; i += lanes) acc0 = O::max(O::load(data + i), acc0);             \
+        acc0 = O::max(O::max(acc0, acc1), O::max(acc2, acc3));                                     \
+        T values[lanes];                                                                           \
+        O::store(values, acc0);                                                                    \
+        return maxFrom(data + i, count - i, maxFrom(values, lanes, identity<T>()));                \
+    }                                                                                              \
+                                                                                                   \
+    template <typename T>                                                                          \
+    __attribute__((target(Target))) std::size_t find##Name(const T* data, std::size_t count, T value) { \
+        using O = Ops<T>;                                                                          \
+        const typename O::V target = O::set1(value);                                               \
+        std::size_t i = 0;                                                                         \
+        for (; i + O::lanes <= count; i += O::lanes) {                                             \
+            const std::uint64_t mask = O::equal(O::load(data + i), target);                        \
+            if (mask != 0) return i + static_cast<std::size_t>(__builtin_ctzll(mask)) / O::bitsPerLane; \
+        }                                                                                          \
+        return i + findScalar(data + i, count - i, value);                                         \
+    }
+
+MAX_REDUCE_KERNELS(Avx2, "avx2", Avx2Ops)
+MAX_REDUCE_KERNELS(Avx512, "avx512f,avx512bw", Avx512Ops)
+
+#undef MAX_REDUCE_KERNELS
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // MAX_REDUCE_X86
+
+// ----------------------------
+// Despacho
+// ----------------------------
+template <typename T>
+struct Entry {
+    T (*max)(const T*, std::size_t);
+    std::size_t (*find)(const T*, std::size_t, T);
+};
+
+struct Table {
+    Entry<std::int8_t> i8;
+    Entry<std::int16_t> i16;
+    Entry<std::int32_t> i32;
+    Entry<std::int64_t> i64;
+    Entry<float> f32;
+    Entry<double> f64;
+};
+
+#define MAX_REDUCE_TABLE(max, find)                                                                \
+    Table {                                                                                        \
+        {max<std::int8_t>, find<std::int8_t>}, {max<std::int16_t>, find<std::int16_t>},            \
+            {max<std::int32_t>, find<std::int32_t>}, {max<std::int64_t>, find<std::int64_t>},      \
+            {max<float>, find<float>}, {max<double>, find<double>},                                \
+    }
+
+const Table scalarTable = MAX_REDUCE_TABLE(maxScalar, findScalar);
+#ifdef MAX_REDUCE_X86
+const Table avx2Table = MAX_REDUCE_TABLE(maxAvx2, findAvx2);
+const Table avx512Table = MAX_REDUCE_TABLE(maxAvx512, findAvx512);
+#endif
+
+#undef MAX_REDUCE_TABLE
+
+template <typename T>
+const Entry<T>& entry(const Table& table) {
+    if constexpr (std::is_same_v<T, std::int8_t>) return table.i8;
+    else if constexpr (std::is_same_v<T, std::int16_t>) return table.i16;
+    else if constexpr (std::is_same_v<T, std::int32_t>) return table.i32;
+    else if constexpr (std::is_same_v<T, std::int64_t>) return table.i64;
+    else if constexpr (std::is_same_v<T, float>) return table.f32;
+    else return table.f64;
+}
+
+bool supports(Kernel kernel) {
+#ifdef MAX_REDUCE_X86
+    if (kernel == Kernel::Avx2) return __builtin_cpu_supports("avx2");
+    if (kernel == Kernel::Avx512) return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+    return kernel == Kernel::Scalar;
+}
+
+const Table& tableFor(Kernel kernel) {
+#ifdef MAX_REDUCE_X86
+    if (kernel == Kernel::Avx512) return avx512Table;
+    if (kernel == Kernel::Avx2) return avx2Table;
+#endif
+    return scalarTable;
+}
+
+struct Dispatch {
+    Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state = [] {
+        Kernel best = Kernel::Scalar;
+        if (supports(Kernel::Avx2)) best = Kernel::Avx2;
+        if (supports(Kernel::Avx512)) best = Kernel::Avx512;
+        return Dispatch{best, &tableFor(best)};
+    }();
+    return state;
+}
+
+template <typename T>
+T maxValueImpl(const T* data, std::size_t count) {
+    const Entry<T>& kernels = entry<T>(*dispatch().table);
+    const T best = kernels.max(data, count);
+    // -infinito es también lo que queda si todo era NaN: se distingue buscándolo.
+    if constexpr (std::is_floating_point_v<T>) {
+        if (best == identity<T>() && kernels.find(data, count, best) == count) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+    return best;
+}
+
+// Dos pasadas: el máximo y luego su primera aparición. La segunda suele
+// pararse antes del final y las dos van a la velocidad de la memoria.
+template <typename T>
+std::size_t argMaxImpl(const T* data, std::size_t count) {
+    const Entry<T>& kernels = entry<T>(*dispatch().table);
+    return kernels.find(data, count, kernels.max(data, count));
+}
+
+} // namespace
+
+Kernel activeKernel() {
+    return dispatch().kernel;
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Avx512: return "AVX-512";
+    case Kernel::Avx2: return "AVX2";
+    default: return "escalar";
+    }
+}
+
+std::int8_t maxValue(const std::int8_t* data, std::size_t count) { return maxValueImpl(data, count); }
+std::int16_t maxValue(const std::int16_t* data, std::size_t count) { return maxValueImpl(data, count); }
+std::int32_t maxValue(const std::int32_t* data, std::size_t count) { return maxValueImpl(data, count); }
+std::int64_t maxValue(const std::int64_t* data, std::size_t count) { return maxValueImpl(data, count); }
+float maxValue(const float* data, std::size_t count) { return maxValueImpl(data, count); }
+double maxValue(const double* data, std::size_t count) { return maxValueImpl(data, count); }
+
+std::size_t argMax(const std::int8_t* data, std::size_t count) { return argMaxImpl(data, count); }
+std::size_t argMax(const std::int16_t* data, std::size_t count) { return argMaxImpl(data, count); }
+std::size_t argMax(const std::int32_t* data, std::size_t count) { return argMaxImpl(data, count); }
+std::size_t argMax(const std::int64_t* data, std::size_t count) { return argMaxImpl(data, count); }
+std::size_t argMax(const float* data, std::size_t count) { return argMaxImpl(data, count); }
+std::size_t argMax(const double* data, std::size_t count) { return argMaxImpl(data, count); }
+
+} // namespace max_reduce
@@ -0,0 +1,87 @@
+#ifndef MAX_REDUCE_H
+#define MAX_REDUCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace max_reduce
+ * @brief El mayor de N números (y su posición) con AVX2 / AVX-512.
+ *
+ * Generaliza ThreeNumbers::findLargest a arrays de millones de elementos de
+ * tipo int8_t, int16_t, int32_t, int64_t, float o double. Hay kernel escalar,
+ * AVX2 y AVX-512, elegidos en tiempo de ejecución según la CPU.
+ *
+ * Semántica:
+ * - argMax devuelve la posición de la primera aparición del máximo, como
+ *   std::max_element; count si no hay ninguno (array vacío o todo NaN).
+ * - En float y double los NaN se ignoran (como std::fmax). Si no queda
+ *   ningún número, maxValue devuelve NaN. +0.0 y -0.0 cuentan como iguales.
+ * - maxValue de un array vacío de enteros devuelve el mínimo del tipo.
+ */
+namespace max_reduce {
+
+/// Implementaciones disponibles.
+enum class Kernel { Scalar, Avx2, Avx512 };
+
+Kernel activeKernel();
+bool forceKernel(Kernel kernel);
+const char* kernelName(Kernel kernel);
+
+std::int8_t maxValue(const std::int8_t* data, std::size_t count);
+std::int16_t maxValue(const std::int16_t* data, std::size_t count);
+std::int32_t maxValue(const std::int32_t* data, std::size_t count);
+std::int64_t maxValue(const std::int64_t* data, std::size_t count);
+float maxValue(const float* data, std::size_t count);
+double maxValue(const double* data, std::size_t count);
+
+std::size_t argMax(const std::int8_t* data, std::size_t count);
+std::size_t argMax(const std::int16_t* data, std::size_t count);
+std::size_t argMax(const std::int32_t* data, std::size_t count);
+std::size_t argMax(const std::int64_t* data, std::size_t count);
+std::size_t argMax(const float* data, std::size_t count);
+std::size_t argMax(const double* data, std::size_t count);
+
+template <typename T>
+T maxValue(const std::vector<T>& values) {
+    return maxValue(values.data(), values.size());
+}
+
+template <typename T>
+std::size_t argMax(const std::vector<T>& values) {
+    return argMax(values.data(), values.size());
+}
+
+} // namespace max_reduce
+
+/**
+ * @class Numbers
+ * @brief Como ThreeNumbers, pero con cualquier cantidad de números.
+ *
+ * @code
+ * Numbers<> numbers{num1, num2, num3};     // igual que ThreeNumbers
+ * std::cout << numbers.findLargest();
+ * @endcode
+ */
+template <typename T = int>
+class Numbers {
+public:
+    Numbers(std::initializer_list<T> values) : values_(values) { }
+    explicit Numbers(std::vector<T> values) : values_(std::move(values)) { }
+
+    /// El mayor de los números (ver max_reduce::maxValue para vacíos y NaN).
+    T findLargest() const { return max_reduce::maxValue(values_); }
+
+    /// Posición del primer mayor, o size() si no hay ninguno.
+    std::size_t findLargestIndex() const { return max_reduce::argMax(values_); }
+
+    std::size_t size() const { return values_.size(); }
+
+private:
+    std::vector<T> values_;
+};
+
+#endif // MAX_REDUCE_H
@@ -0,0 +1,130 @@
+#include "parallel_reduce.h"
+
+#include <stdexcept>
+
+namespace {
+
+constexpr std::uint64_t packRange(std::uint64_t begin, std::uint64_t end) {
+    return begin << 32 | end;
+}
+
+constexpr std::uint64_t rangeBegin(std::uint64_t bounds) { return bounds >> 32; }
+constexpr std::uint64_t rangeEnd(std::uint64_t bounds) { return bounds & 0xFFFF'FFFFu; }
+
+} // namespace
+
+// ----------------------------
+// Hilos
+// ----------------------------
+WorkStealingPool::WorkStealingPool(unsigned threads)
+    : threadCount_(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+      ranges_(new Range[threadCount_]) {
+    // El hilo 0 es siempre el que llama a parallelFor.
+    workers_.reserve(threadCount_ - 1);
+    for (unsigned index = 1; index < threadCount_; ++index) {
+        workers_.emplace_back([this, index] { workerLoop(index); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (std::thread& worker : workers_) worker.join();
+}
+
+void WorkStealingPool::parallelFor(std::size_t tasks, const std::function<void(std::size_t)>& body) {
+    if (tasks == 0) return;
+    if (tasks > 0xFFFF'FFFFu) throw std::length_error{"WorkStealingPool: demasiadas tareas"};
+
+    const std::lock_guard<std::mutex> run{runMutex_};
+    steals_.store(0, std::memory_order_relaxed);
+    if (threadCount_ == 1) {
+        for (std::size_t task = 0; task < tasks; ++task) body(task);
+        return;
+    }
+
+    // Reparto inicial: rangos contiguos del mismo tamaño (±1).
+    for (unsigned index = 0; index < threadCount_; ++index) {
+        const std::uint64_t begin = tasks * index / threadCount_;
+        const std::uint64_t end = tasks * (index + 1) / threadCount_;
+        ranges_[index].bounds.store(packRange(begin, end), std::memory_order_relaxed);
+    }
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        body_ = &body;
+        pending_ = threadCount_ - 1;
+        ++generation_;
+    }
+    start_.notify_all();
+
+    runTasks(0);
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    done_.wait(lock, [&] { return pending_ == 0; });
+    body_ = nullptr;
+}
+
+void WorkStealingPool::workerLoop(unsigned index) {
+    std::uint64_t seen{0};
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        runTasks(index);
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+            if (--pending_ != 0) continue;
+        }
+        done_.notify_one();
+    }
+}
+
+void WorkStealingPool::runTasks(unsigned index) {
+    const std::function<void(std::size_t)>& body = *body_;
+    std::size_t task{};
+    while (popLocal(index, task) || steal(index, task)) body(task);
+}
+
+// ----------------------------
+// Tomar y robar tareas
+// ----------------------------
+bool WorkStealingPool::popLocal(unsigned index, std::size_t& task) {
+    std::atomic<std::uint64_t>& bounds = ranges_[index].bounds;
+    std::uint64_t current = bounds.load(std::memory_order_acquire);
+    while (rangeBegin(current) < rangeEnd(current)) {
+        if (bounds.compare_exchange_weak(current, packRange(rangeBegin(current) + 1, rangeEnd(current)),
+                                         std::memory_order_acq_rel)) {
+            task = rangeBegin(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Roba la mitad final del primer rango no vacío, empezando por el vecino.
+// El ladrón ejecuta la primera tarea robada y deja el resto en su propio
+// rango, que estaba vacío, para que otros puedan robárselo a su vez.
+bool WorkStealingPool::steal(unsigned thief, std::size_t& task) {
+    for (unsigned offset = 1; offset < threadCount_; ++offset) {
+        std::atomic<std::uint64_t>& bounds = ranges_[(thief + offset) % threadCount_].bounds;
+        std::uint64_t current = bounds.load(std::memory_order_acquire);
+        while (rangeBegin(current) < rangeEnd(current)) {
+            const std::uint64_t begin = rangeBegin(current);
+            const std::uint64_t end = rangeEnd(current);
+            const std::uint64_t middle = begin + (end - begin) / 2;
+            if (bounds.compare_exchange_weak(current, packRange(begin, middle), std::memory_order_acq_rel)) {
+                ranges_[thief].bounds.store(packRange(middle + 1, end), std::memory_order_release);
+                steals_.fetch_add(1, std::memory_order_relaxed);
+                task = middle;
+                return true;
+            }
+        }
+    }
+    return false;
+}
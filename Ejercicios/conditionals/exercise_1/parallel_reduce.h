@@ -0,0 +1,140 @@
+#ifndef PARALLEL_REDUCE_H
+#define PARALLEL_REDUCE_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "max_reduce.h"
+
+/**
+ * @class WorkStealingPool
+ * @brief Hilos fijos que se reparten tareas numeradas 0..n-1.
+ *
+ * Cada hilo empieza con un rango contiguo de tareas y las consume desde el
+ * principio. Cuando se queda sin trabajo roba la mitad final del rango de
+ * otro hilo, así que un hilo lento (o un núcleo ocupado por otro proceso) no
+ * retrasa al resto. Cada rango es un único entero atómico de 64 bits
+ * (inicio y fin), por lo que tomar o robar tareas no usa mutex.
+ *
+ * El hilo que llama a parallelFor también trabaja: con un solo hilo no se
+ * crea ninguno y las tareas se ejecutan en orden.
+ */
+class WorkStealingPool {
+public:
+    /// @param threads Hilos en total, contando el que llama; 0 = hardware_concurrency.
+    explicit WorkStealingPool(unsigned threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    unsigned threads() const { return threadCount_; }
+
+    /**
+     * @brief Ejecuta body(i) para cada i en [0, tasks) y espera a que acaben.
+     *
+     * body no debe lanzar excepciones. Las llamadas desde varios hilos se
+     * ejecutan de una en una.
+     */
+    void parallelFor(std::size_t tasks, const std::function<void(std::size_t)>& body);
+
+    /// Robos con éxito en la última llamada a parallelFor.
+    std::size_t lastSteals() const { return steals_.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(64) Range {
+        std::atomic<std::uint64_t> bounds{0}; // inicio << 32 | fin
+    };
+
+    void workerLoop(unsigned index);
+    void runTasks(unsigned index);
+    bool popLocal(unsigned index, std::size_t& task);
+    bool steal(unsigned thief, std::size_t& task);
+
+    unsigned threadCount_;
+    std::unique_ptr<Range[]> ranges_;
+    std::vector<std::thread> workers_;
+    const std::function<void(std::size_t)>* body_{nullptr};
+    std::atomic<std::size_t> steals_{0};
+
+    std::mutex runMutex_; // una parallelFor a la vez
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::uint64_t generation_{0};
+    unsigned pending_{0};
+    bool stop_{false};
+};
+
+/**
+ * @namespace parallel_reduce
+ * @brief Reducciones de arrays enormes repartidas entre varios hilos.
+ *
+ * El array se divide en trozos que caben en la caché L2 (defaultChunkBytes).
+ * Cada trozo se reduce por separado en el pool y su resultado parcial se
+ * guarda en su posición; al final se combinan los parciales en el orden del
+ * array. Por eso basta con que combine sea asociativa: no hace falta que sea
+ * conmutativa, y una suma de double da siempre el mismo resultado para el
+ * mismo tamaño de trozo, tenga el pool los hilos que tenga.
+ */
+namespace parallel_reduce {
+
+/// Bytes de cada trozo por defecto.
+constexpr std::size_t defaultChunkBytes = std::size_t{256} << 10;
+
+/**
+ * @brief Reduce data[0, count) en paralelo.
+ * @param identity Resultado de un array vacío; neutro para combine.
+ * @param reduceChunk Value(const T* first, std::size_t count): reduce un trozo.
+ * @param combine Value(Value, Value): asociativa.
+ * @param chunkElements Elementos por trozo; 0 = defaultChunkBytes / sizeof(T).
+ */
+template <typename T, typename Value, typename ReduceChunk, typename Combine>
+Value reduce(WorkStealingPool& pool, const T* data, std::size_t count, Value identity, ReduceChunk reduceChunk,
+             Combine combine, std::size_t chunkElements = 0) {
+    if (chunkElements == 0) chunkElements = std::max<std::size_t>(1, defaultChunkBytes / sizeof(T));
+    const std::size_t chunks = (count + chunkElements - 1) / chunkElements;
+    std::vector<Value> partials(chunks, identity);
+    pool.parallelFor(chunks, [&](std::size_t chunk) {
+        const std::size_t first = chunk * chunkElements;
+        partials[chunk] = reduceChunk(data + first, std::min(chunkElements, count - first));
+    });
+
+    Value result = std::move(identity);
+    for (Value& partial : partials) result = combine(std::move(result), std::move(partial));
+    return result;
+}
+
+/// El mayor valor, con la misma semántica que max_reduce::maxValue.
+template <typename T>
+T maxValue(WorkStealingPool& pool, const T* data, std::size_t count) {
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaN como identidad: se queda solo si todos los trozos son NaN.
+        return reduce(pool, data, count, std::numeric_limits<T>::quiet_NaN(),
+                      [](const T* first, std::size_t n) { return max_reduce::maxValue(first, n); },
+                      [](T a, T b) { return b > a || a != a ? b : a; });
+    } else {
+        return reduce(pool, data, count, std::numeric_limits<T>::min(),
+                      [](const T* first, std::size_t n) { return max_reduce::maxValue(first, n); },
+                      [](T a, T b) { return std::max(a, b); });
+    }
+}
+
+template <typename T>
+T maxValue(WorkStealingPool& pool, const std::vector<T>& values) {
+    return maxValue(pool, values.data(), values.size());
+}
+
+} // namespace parallel_reduce
+
+#endif // PARALLEL_REDUCE_H
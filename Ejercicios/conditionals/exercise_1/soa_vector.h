@@ -0,0 +1,229 @@
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#define SOA_VECTOR_HAS_SPAN 1
+#endif
+
+/**
+ * @class SoaColumn
+ * @brief Vista de una columna de un SoaVector: un array contiguo de T.
+ *
+ * Se invalida igual que los iteradores de std::vector (al crecer el SoaVector).
+ */
+template <typename T>
+class SoaColumn {
+public:
+    SoaColumn(T* data, std::size_t size) : data_(data), size_(size) { }
+
+    T* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    T* begin() const { return data_; }
+    T* end() const { return data_ + size_; }
+    T& operator[](std::size_t index) const { return data_[index]; }
+
+#ifdef SOA_VECTOR_HAS_SPAN
+    operator std::span<T>() const { return {data_, size_}; }
+#endif
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+/**
+ * @class SoaVector
+ * @brief Como std::vector<std::tuple<Ts...>>, pero con cada campo en su
+ *        propio array contiguo (struct of arrays).
+ *
+ * Recorrer un solo campo lee solo ese campo: con tres int, un tercio de la
+ * memoria que leería un vector de structs. Acceder a un registro entero
+ * toca una línea de caché por campo en lugar de una.
+ *
+ * Se usa como un vector de registros; cada registro se ve como una tupla de
+ * referencias:
+ * @code
+ * SoaVector<int, int, int> triples;
+ * triples.reserve(n);
+ * triples.push_back(1, 2, 3);
+ * for (auto [a, b, c] : triples) a = std::max(a, b);    // a es int&
+ * SoaColumn<int> first = triples.column<0>();            // un campo entero
+ * @endcode
+ */
+template <typename... Ts>
+class SoaVector {
+    static_assert(sizeof...(Ts) > 0, "SoaVector: al menos un campo");
+    static_assert((!std::is_same_v<Ts, bool> && ...), "SoaVector: std::vector<bool> no es contiguo, usar char");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = std::size_t;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    /// Iterador de acceso aleatorio; al desreferenciarlo da una tupla de referencias.
+    template <bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, std::tuple<const Ts&...>, std::tuple<Ts&...>>;
+        using pointer = void;
+
+        Iterator() = default;
+
+        reference operator*() const { return (*this)[0]; }
+        reference operator[](difference_type offset) const {
+            return std::apply([&](auto*... column) { return reference{column[index_ + offset]...}; }, columns_);
+        }
+
+        Iterator& operator++() { ++index_; return *this; }
+        Iterator operator++(int) { Iterator old = *this; ++index_; return old; }
+        Iterator& operator--() { --index_; return *this; }
+        Iterator operator--(int) { Iterator old = *this; --index_; return old; }
+        Iterator& operator+=(difference_type offset) { index_ += offset; return *this; }
+        Iterator& operator-=(difference_type offset) { index_ -= offset; return *this; }
+        Iterator operator+(difference_type offset) const { return Iterator{columns_, index_ + offset}; }
+        Iterator operator-(difference_type offset) const { return Iterator{columns_, index_ - offset}; }
+        friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
+
+        // iterator y const_iterator se pueden mezclar, como en std::vector.
+        template <bool OtherConst>
+        difference_type operator-(const Iterator<OtherConst>& other) const { return index_ - other.index_; }
+        template <bool OtherConst>
+        bool operator==(const Iterator<OtherConst>& other) const { return index_ == other.index_; }
+        template <bool OtherConst>
+        bool operator!=(const Iterator<OtherConst>& other) const { return index_ != other.index_; }
+        template <bool OtherConst>
+        bool operator<(const Iterator<OtherConst>& other) const { return index_ < other.index_; }
+        template <bool OtherConst>
+        bool operator>(const Iterator<OtherConst>& other) const { return index_ > other.index_; }
+        template <bool OtherConst>
+        bool operator<=(const Iterator<OtherConst>& other) const { return index_ <= other.index_; }
+        template <bool OtherConst>
+        bool operator>=(const Iterator<OtherConst>& other) const { return index_ >= other.index_; }
+
+        /// De iterator a const_iterator.
+        operator Iterator<true>() const { return Iterator<true>{columns_, index_}; }
+
+    private:
+        friend class SoaVector;
+        template <bool>
+        friend class Iterator;
+        using Columns = std::conditional_t<Const, std::tuple<const Ts*...>, std::tuple<Ts*...>>;
+
+        Iterator(Columns columns, difference_type index) : columns_(columns), index_(index) { }
+
+        Columns columns_{};
+        difference_type index_{0};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SoaVector() = default;
+
+    std::size_t size() const { return std::get<0>(columns_).size(); }
+    bool empty() const { return size() == 0; }
+
+    /// Registros que caben sin volver a reservar memoria en ninguna columna.
+    std::size_t capacity() const {
+        return std::apply([](const auto&... column) { return std::min({column.capacity()...}); }, columns_);
+    }
+
+    void reserve(std::size_t count) {
+        std::apply([&](auto&... column) { (column.reserve(count), ...); }, columns_);
+    }
+
+    void resize(std::size_t count) {
+        std::apply([&](auto&... column) { (column.resize(count), ...); }, columns_);
+    }
+
+    void clear() {
+        std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+    }
+
+    /// Añade un registro. Si copiar algún campo lanza, el SoaVector queda como estaba.
+    void push_back(const Ts&... values) {
+        const std::size_t oldSize = size();
+        try {
+            pushFields(std::index_sequence_for<Ts...>{}, values...);
+        } catch (...) {
+            std::apply([&](auto&... column) { (column.erase(column.begin() + oldSize, column.end()), ...); },
+                       columns_);
+            throw;
+        }
+    }
+
+    void push_back(const value_type& record) {
+        std::apply([&](const Ts&... values) { push_back(values...); }, record);
+    }
+
+    void pop_back() {
+        std::apply([](auto&... column) { (column.pop_back(), ...); }, columns_);
+    }
+
+    reference operator[](std::size_t index) {
+        return std::apply([&](auto&... column) { return reference{column[index]...}; }, columns_);
+    }
+
+    const_reference operator[](std::size_t index) const {
+        return std::apply([&](const auto&... column) { return const_reference{column[index]...}; }, columns_);
+    }
+
+    reference back() { return (*this)[size() - 1]; }
+    const_reference back() const { return (*this)[size() - 1]; }
+
+    /// El campo I de todos los registros, contiguo.
+    template <std::size_t I>
+    SoaColumn<field_type<I>> column() {
+        auto& values = std::get<I>(columns_);
+        return {values.data(), values.size()};
+    }
+
+    template <std::size_t I>
+    SoaColumn<const field_type<I>> column() const {
+        const auto& values = std::get<I>(columns_);
+        return {values.data(), values.size()};
+    }
+
+    iterator begin() { return iterator{dataPointers(), 0}; }
+    iterator end() { return iterator{dataPointers(), static_cast<std::ptrdiff_t>(size())}; }
+    const_iterator begin() const { return const_iterator{dataPointers(), 0}; }
+    const_iterator end() const { return const_iterator{dataPointers(), static_cast<std::ptrdiff_t>(size())}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+private:
+    template <std::size_t... I>
+    void pushFields(std::index_sequence<I...>, const Ts&... values) {
+        (std::get<I>(columns_).push_back(values), ...);
+    }
+
+    std::tuple<Ts*...> dataPointers() {
+        return std::apply([](auto&... column) { return std::tuple<Ts*...>{column.data()...}; }, columns_);
+    }
+
+    std::tuple<const Ts*...> dataPointers() const {
+        return std::apply([](const auto&... column) { return std::tuple<const Ts*...>{column.data()...}; },
+                          columns_);
+    }
+
+    std::tuple<std::vector<Ts>...> columns_;
+};
+
+#endif // SOA_VECTOR_H
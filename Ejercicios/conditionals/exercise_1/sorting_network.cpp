@@ -0,0 +1,35 @@
+#include "sorting_network.h"
+
+namespace sorting_network {
+
+namespace {
+
+bool supports(Kernel kernel) {
+#ifdef SORTING_NETWORK_X86
+    if (kernel == Kernel::Avx2) return __builtin_cpu_supports("avx2");
+#endif
+    return kernel == Kernel::Scalar;
+}
+
+Kernel& current() {
+    static Kernel kernel = supports(Kernel::Avx2) ? Kernel::Avx2 : Kernel::Scalar;
+    return kernel;
+}
+
+} // namespace
+
+Kernel activeKernel() {
+    return current();
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    current() = kernel;
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    return kernel == Kernel::Avx2 ? "AVX2" : "escalar";
+}
+
+} // namespace sorting_network
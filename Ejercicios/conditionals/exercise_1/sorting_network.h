@@ -0,0 +1,452 @@
+#ifndef SORTING_NETWORK_H
+#define SORTING_NETWORK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SORTING_NETWORK_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @namespace sorting_network
+ * @brief Ordenar y seleccionar (mínimo, máximo, mediana) grupos pequeños de
+ *        tamaño fijo con redes de comparación generadas al compilar.
+ *
+ * ThreeNumbers::findLargest compara sus tres números uno a uno. Aquí la
+ * secuencia de comparaciones para N elementos se genera en tiempo de
+ * compilación y se despliega entera: sin bucles ni saltos, cada comparación
+ * es un mínimo y un máximo.
+ *
+ * - Ordenar: red par-impar de Batcher.
+ * - Mínimo y máximo: torneo de N - 1 comparaciones en log2(N) niveles.
+ * - Otra posición K (la mediana): la red de Batcher sin las comparaciones
+ *   que no influyen en K; de las que quedan, muchas solo necesitan el
+ *   mínimo o solo el máximo.
+ *
+ * Dos disposiciones:
+ * - Un grupo: sort<N>(values), median<N>(values)...
+ * - Muchos grupos traspuestos: el elemento i del grupo g está en
+ *   data[i * groups + g]. Cada comparación se aplica a 8 grupos de int32_t
+ *   (32 de int8_t) a la vez con AVX2.
+ *
+ * Como std::sort, el resultado con NaN no está definido.
+ */
+namespace sorting_network {
+
+/// Implementaciones de las variantes traspuestas.
+enum class Kernel { Scalar, Avx2 };
+
+Kernel activeKernel();
+bool forceKernel(Kernel kernel);
+const char* kernelName(Kernel kernel);
+
+/// Compara las posiciones low < high: deja el menor en low y el mayor en high.
+struct Comparator {
+    static constexpr std::uint8_t writeLow = 1;
+    static constexpr std::uint8_t writeHigh = 2;
+
+    std::uint8_t low;
+    std::uint8_t high;
+    std::uint8_t writes; // qué salidas hacen falta; la otra posición no cambia
+};
+
+namespace detail {
+
+// Red par-impar de Batcher para cualquier n (no solo potencias de dos).
+template <typename Visit>
+constexpr void batcher(std::size_t n, Visit&& visit) {
+    for (std::size_t p = 1; p < n; p += p) {
+        for (std::size_t k = p; k > 0; k /= 2) {
+            for (std::size_t j = k % p; j + k < n; j += k + k) {
+                for (std::size_t i = 0; i < k && i + j + k < n; ++i) {
+                    if ((i + j) / (p + p) == (i + j + k) / (p + p)) visit(i + j, i + j + k);
+                }
+            }
+        }
+    }
+}
+
+// Torneo hacia la posición 0 (mínimo) o n - 1 (máximo): en cada nivel se
+// comparan los ganadores del anterior por parejas.
+template <typename Visit>
+constexpr void tournament(std::size_t n, bool toHigh, Visit&& visit) {
+    for (std::size_t step = 1; step < n; step += step) {
+        for (std::size_t i = 0; i + step < n; i += step + step) {
+            if (toHigh) {
+                visit(n - 1 - i - step, n - 1 - i);
+            } else {
+                visit(i, i + step);
+            }
+        }
+    }
+}
+
+constexpr Comparator makeComparator(std::size_t low, std::size_t high, std::uint8_t writes) {
+    return Comparator{static_cast<std::uint8_t>(low), static_cast<std::uint8_t>(high), writes};
+}
+
+template <std::size_t N, std::size_t Size>
+constexpr std::array<Comparator, Size> batcherComparators() {
+    std::array<Comparator, Size> comparators{};
+    std::size_t next{0};
+    batcher(N, [&](std::size_t low, std::size_t high) {
+        comparators[next++] = makeComparator(low, high, Comparator::writeLow | Comparator::writeHigh);
+    });
+    return comparators;
+}
+
+template <std::size_t N, std::size_t K>
+constexpr bool isTournament() {
+    return N > 1 && (K == 0 || K == N - 1);
+}
+
+template <std::size_t N, std::size_t K, std::size_t Size>
+constexpr std::array<Comparator, Size> tournamentComparators() {
+    std::array<Comparator, Size> comparators{};
+    std::size_t next{0};
+    const bool toHigh = K == N - 1;
+    tournament(N, toHigh, [&](std::size_t low, std::size_t high) {
+        comparators[next++] = makeComparator(low, high, toHigh ? Comparator::writeHigh : Comparator::writeLow);
+    });
+    return comparators;
+}
+
+// Recorriendo la red hacia atrás desde la posición K: una comparación hace
+// falta si alguna de sus salidas hace falta, y entonces sus dos entradas
+// pasan a hacer falta. writes == 0 marca las que sobran.
+template <std::size_t Size>
+constexpr std::array<Comparator, Size> prunedFor(std::array<Comparator, Size> comparators, std::size_t k) {
+    std::array<bool, 256> needed{};
+    needed[k] = true;
+    for (std::size_t c = Size; c-- > 0;) {
+        Comparator& comparator = comparators[c];
+        comparator.writes = static_cast<std::uint8_t>((needed[comparator.low] ? Comparator::writeLow : 0) |
+                                                      (needed[comparator.high] ? Comparator::writeHigh : 0));
+        if (comparator.writes != 0) {
+            needed[comparator.low] = true;
+            needed[comparator.high] = true;
+        }
+    }
+    return comparators;
+}
+
+template <std::size_t Size>
+constexpr std::size_t countWriting(const std::array<Comparator, Size>& comparators) {
+    std::size_t count{0};
+    for (const Comparator comparator : comparators) count += comparator.writes != 0 ? 1 : 0;
+    return count;
+}
+
+template <std::size_t Out, std::size_t Size>
+constexpr std::array<Comparator, Out> keepWriting(const std::array<Comparator, Size>& comparators) {
+    std::array<Comparator, Out> kept{};
+    std::size_t next{0};
+    for (const Comparator comparator : comparators) {
+        if (comparator.writes != 0) kept[next++] = comparator;
+    }
+    return kept;
+}
+
+// Posiciones que la red lee: las únicas que hay que cargar.
+template <std::size_t N, std::size_t Size>
+constexpr std::array<bool, N> inputRows(const std::array<Comparator, Size>& comparators, std::size_t always) {
+    std::array<bool, N> inputs{};
+    inputs[always] = true;
+    for (const Comparator comparator : comparators) {
+        inputs[comparator.low] = true;
+        inputs[comparator.high] = true;
+    }
+    return inputs;
+}
+
+} // namespace detail
+
+/**
+ * @brief Red de ordenación de N elementos.
+ *
+ * Para N <= 8 tiene el mínimo número de comparaciones posible; para 16 y 32,
+ * 63 y 191 frente a los 60 y 185 de las mejores redes conocidas.
+ */
+template <std::size_t N>
+struct SortingNetwork {
+    static_assert(N >= 1 && N <= 256, "sorting_network: N entre 1 y 256");
+    static constexpr std::size_t elements = N;
+    static constexpr std::size_t size = [] {
+        std::size_t count{0};
+        detail::batcher(N, [&](std::size_t, std::size_t) { ++count; });
+        return count;
+    }();
+    static constexpr std::array<Comparator, size> comparators = detail::batcherComparators<N, size>();
+    static constexpr std::array<bool, N> inputs = detail::inputRows<N>(comparators, 0);
+};
+
+/// Red que deja en la posición K el elemento que tendría tras ordenar.
+template <std::size_t N, std::size_t K>
+struct SelectionNetwork {
+    static_assert(K < N, "sorting_network: K fuera del grupo");
+    static constexpr std::size_t elements = N;
+    static constexpr std::size_t size = detail::isTournament<N, K>()
+                                            ? N - 1
+                                            : detail::countWriting(detail::prunedFor(SortingNetwork<N>::comparators, K));
+    static constexpr std::array<Comparator, size> comparators = [] {
+        if constexpr (detail::isTournament<N, K>()) {
+            return detail::tournamentComparators<N, K, size>();
+        } else {
+            return detail::keepWriting<size>(detail::prunedFor(SortingNetwork<N>::comparators, K));
+        }
+    }();
+    static constexpr std::array<bool, N> inputs = detail::inputRows<N>(comparators, K);
+};
+
+namespace detail {
+
+// ----------------------------
+// Un grupo
+// ----------------------------
+// Con el operador ternario el compilador usa cmov o minss/maxss: sin saltos.
+// writes es constante en cada llamada desplegada, así que los if desaparecen.
+template <std::uint8_t Writes, typename T>
+inline void compareExchange(T& a, T& b) {
+    const T low = b < a ? b : a;
+    const T high = b < a ? a : b;
+    if constexpr ((Writes & Comparator::writeLow) != 0) a = low;
+    if constexpr ((Writes & Comparator::writeHigh) != 0) b = high;
+}
+
+template <typename Net, typename T, std::size_t... C>
+inline void applyNetwork([[maybe_unused]] T* values, std::index_sequence<C...>) {
+    (compareExchange<Net::comparators[C].writes>(values[Net::comparators[C].low], values[Net::comparators[C].high]),
+     ...);
+}
+
+template <typename Net, typename T>
+inline void apply(T* values) {
+    applyNetwork<Net>(values, std::make_index_sequence<Net::size>{});
+}
+
+// ----------------------------
+// Grupos traspuestos: escalar
+// ----------------------------
+// Una columna cada vez, con la misma red desplegada que para un grupo.
+// K < N: solo se guarda la fila K en out. K == N: todas las filas, en out.
+template <typename Net, std::size_t K, typename T>
+void applyColumns(const T* data, std::size_t groups, std::size_t first, T* out) {
+    constexpr std::size_t n = Net::elements;
+    for (std::size_t g = first; g < groups; ++g) {
+        T column[n];
+        for (std::size_t r = 0; r < n; ++r) {
+            if (Net::inputs[r]) column[r] = data[r * groups + g];
+        }
+        apply<Net>(column);
+        if constexpr (K < n) {
+            out[g] = column[K];
+        } else {
+            for (std::size_t r = 0; r < n; ++r) out[r * groups + g] = column[r];
+        }
+    }
+}
+
+#ifdef SORTING_NETWORK_X86
+
+// ----------------------------
+// Grupos traspuestos: AVX2
+// ----------------------------
+// Cada Ops da: V, lanes, load, store, min y max.
+#define SORTING_NETWORK_AVX2 __attribute__((target("avx2"), always_inline)) static inline
+
+template <typename T>
+struct Avx2Ops;
+
+template <typename T>
+struct Avx2IntegerOps {
+    using V = __m256i;
+    static constexpr std::size_t lanes = 32 / sizeof(T);
+    SORTING_NETWORK_AVX2 V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    SORTING_NETWORK_AVX2 void store(T* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+template <>
+struct Avx2Ops<std::int8_t> : Avx2IntegerOps<std::int8_t> {
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_min_epi8(a, b); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_max_epi8(a, b); }
+};
+
+template <>
+struct Avx2Ops<std::int16_t> : Avx2IntegerOps<std::int16_t> {
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_min_epi16(a, b); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_max_epi16(a, b); }
+};
+
+template <>
+struct Avx2Ops<std::int32_t> : Avx2IntegerOps<std::int32_t> {
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_max_epi32(a, b); }
+};
+
+// AVX2 no tiene mínimo ni máximo de 64 bits: comparación y mezcla.
+template <>
+struct Avx2Ops<std::int64_t> : Avx2IntegerOps<std::int64_t> {
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+};
+
+template <>
+struct Avx2Ops<float> {
+    using V = __m256;
+    static constexpr std::size_t lanes = 8;
+    SORTING_NETWORK_AVX2 V load(const float* p) { return _mm256_loadu_ps(p); }
+    SORTING_NETWORK_AVX2 void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_min_ps(a, b); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_max_ps(a, b); }
+};
+
+template <>
+struct Avx2Ops<double> {
+    using V = __m256d;
+    static constexpr std::size_t lanes = 4;
+    SORTING_NETWORK_AVX2 V load(const double* p) { return _mm256_loadu_pd(p); }
+    SORTING_NETWORK_AVX2 void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    SORTING_NETWORK_AVX2 V min(V a, V b) { return _mm256_min_pd(a, b); }
+    SORTING_NETWORK_AVX2 V max(V a, V b) { return _mm256_max_pd(a, b); }
+};
+
+template <typename T, typename = void>
+struct HasAvx2Ops : std::false_type { };
+
+template <typename T>
+struct HasAvx2Ops<T, std::void_t<decltype(Avx2Ops<T>::lanes)>> : std::true_type { };
+
+template <std::uint8_t Writes, typename Ops>
+SORTING_NETWORK_AVX2 void compareExchangeVectors(typename Ops::V& a, typename Ops::V& b) {
+    const typename Ops::V low = Ops::min(a, b);
+    if constexpr ((Writes & Comparator::writeHigh) != 0) b = Ops::max(a, b);
+    if constexpr ((Writes & Comparator::writeLow) != 0) a = low;
+}
+
+template <typename Net, typename Ops, typename T, std::size_t... R>
+SORTING_NETWORK_AVX2 void loadRows(typename Ops::V* rows, const T* data, std::size_t groups,
+                                   std::index_sequence<R...>) {
+    ((Net::inputs[R] ? (void)(rows[R] = Ops::load(data + R * groups)) : (void)0), ...);
+}
+
+template <typename Net, typename Ops, std::size_t... C>
+SORTING_NETWORK_AVX2 void applyVectors([[maybe_unused]] typename Ops::V* rows, std::index_sequence<C...>) {
+    (compareExchangeVectors<Net::comparators[C].writes, Ops>(rows[Net::comparators[C].low],
+                                                             rows[Net::comparators[C].high]),
+     ...);
+}
+
+#undef SORTING_NETWORK_AVX2
+
+template <typename Net, std::size_t K, typename T>
+__attribute__((target("avx2"))) void applyTransposedAvx2(const T* data, std::size_t groups, T* out) {
+    using Ops = Avx2Ops<T>;
+    constexpr std::size_t n = Net::elements;
+    std::size_t g = 0;
+    for (; g + Ops::lanes <= groups; g += Ops::lanes) {
+        typename Ops::V rows[n];
+        loadRows<Net, Ops>(rows, data + g, groups, std::make_index_sequence<n>{});
+        applyVectors<Net, Ops>(rows, std::make_index_sequence<Net::size>{});
+        if constexpr (K < n) {
+            Ops::store(out + g, rows[K]);
+        } else {
+            for (std::size_t r = 0; r < n; ++r) Ops::store(out + r * groups + g, rows[r]);
+        }
+    }
+    applyColumns<Net, K>(data, groups, g, out); // últimas columnas
+}
+
+#endif // SORTING_NETWORK_X86
+
+template <typename Net, std::size_t K, typename T>
+void applyTransposed(const T* data, std::size_t groups, T* out) {
+#ifdef SORTING_NETWORK_X86
+    if constexpr (HasAvx2Ops<T>::value) {
+        if (activeKernel() == Kernel::Avx2) {
+            applyTransposedAvx2<Net, K>(data, groups, out);
+            return;
+        }
+    }
+#endif
+    applyColumns<Net, K>(data, groups, 0, out);
+}
+
+} // namespace detail
+
+// ----------------------------
+// Un grupo de N valores contiguos
+// ----------------------------
+/// Ordena values[0, N) de menor a mayor.
+template <std::size_t N, typename T>
+void sort(T* values) {
+    detail::apply<SortingNetwork<N>>(values);
+}
+
+/// El elemento K de values[0, N) si estuviera ordenado (values no cambia).
+template <std::size_t N, std::size_t K, typename T>
+T select(const T* values) {
+    T copy[N];
+    for (std::size_t i = 0; i < N; ++i) copy[i] = values[i];
+    detail::apply<SelectionNetwork<N, K>>(copy);
+    return copy[K];
+}
+
+/// Mediana (para N par, el menor de los dos centrales).
+template <std::size_t N, typename T>
+T median(const T* values) {
+    return select<N, (N - 1) / 2>(values);
+}
+
+template <std::size_t N, typename T>
+T minimum(const T* values) {
+    return select<N, 0>(values);
+}
+
+template <std::size_t N, typename T>
+T maximum(const T* values) {
+    return select<N, N - 1>(values);
+}
+
+// ----------------------------
+// Muchos grupos traspuestos: data[i * groups + g]
+// ----------------------------
+/// Ordena cada uno de los groups grupos de N elementos (data y out pueden ser el mismo array).
+template <std::size_t N, typename T>
+void sortTransposed(const T* data, std::size_t groups, T* out) {
+    detail::applyTransposed<SortingNetwork<N>, N>(data, groups, out);
+}
+
+template <std::size_t N, typename T>
+void sortTransposed(T* data, std::size_t groups) {
+    sortTransposed<N>(data, groups, data);
+}
+
+/// out[g] = elemento K del grupo g ordenado.
+template <std::size_t N, std::size_t K, typename T>
+void selectTransposed(const T* data, std::size_t groups, T* out) {
+    detail::applyTransposed<SelectionNetwork<N, K>, K>(data, groups, out);
+}
+
+template <std::size_t N, typename T>
+void medianTransposed(const T* data, std::size_t groups, T* out) {
+    selectTransposed<N, (N - 1) / 2>(data, groups, out);
+}
+
+template <std::size_t N, typename T>
+void minimumTransposed(const T* data, std::size_t groups, T* out) {
+    selectTransposed<N, 0>(data, groups, out);
+}
+
+template <std::size_t N, typename T>
+void maximumTransposed(const T* data, std::size_t groups, T* out) {
+    selectTransposed<N, N - 1>(data, groups, out);
+}
+
+} // namespace sorting_network
+
+#endif // SORTING_NETWORK_H
@@ -0,0 +1,267 @@
+#ifndef STREAM_STATS_H
+#define STREAM_STATS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "max_reduce.h"
+
+/**
+ * @namespace stream_stats
+ * @brief El mayor, los k mayores y el mayor de los últimos N valores de un
+ *        flujo que no termina nunca.
+ *
+ * main.cpp lee tres números de std::cin una vez. Aquí los valores llegan sin
+ * fin, uno a uno (push) o por bloques (pushBatch), y la memoria no crece con
+ * la longitud del flujo: O(1) para el máximo, O(k) para los k mayores y
+ * O(window) para la ventana.
+ *
+ * Tipos: los de max_reduce (int8_t, int16_t, int32_t, int64_t, float y
+ * double). Los NaN se ignoran, como en max_reduce; en la ventana ocupan su
+ * posición pero nunca son el máximo.
+ */
+namespace stream_stats {
+
+template <typename T>
+constexpr bool isSupported = std::is_same_v<T, std::int8_t> || std::is_same_v<T, std::int16_t> ||
+                             std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t> ||
+                             std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+namespace detail {
+
+template <typename T>
+bool isNaN(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return value != value;
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @class RunningMax
+ * @brief El mayor valor visto hasta ahora.
+ *
+ * pushBatch usa max_reduce::maxValue: AVX2 / AVX-512 si la CPU los tiene.
+ */
+template <typename T>
+class RunningMax {
+    static_assert(isSupported<T>, "stream_stats: tipo no soportado por max_reduce");
+
+public:
+    void push(T value) {
+        ++count_;
+        if (value > max_ || (!seen_ && !detail::isNaN(value))) {
+            max_ = value;
+            seen_ = true;
+        }
+    }
+
+    void pushBatch(const T* values, std::size_t count) {
+        if (count == 0) return;
+        count_ += count;
+        const T batchMax = max_reduce::maxValue(values, count);
+        if (detail::isNaN(batchMax)) return; // todo NaN
+        if (!seen_ || batchMax > max_) {
+            max_ = batchMax;
+            seen_ = true;
+        }
+    }
+
+    /// Vacío si no ha llegado ningún valor (o solo NaN).
+    std::optional<T> max() const { return seen_ ? std::optional<T>{max_} : std::nullopt; }
+
+    /// Valores recibidos, NaN incluidos.
+    std::uint64_t count() const { return count_; }
+
+private:
+    T max_{};
+    bool seen_{false};
+    std::uint64_t count_{0};
+};
+
+/**
+ * @class SlidingMax
+ * @brief El mayor de los últimos window valores.
+ *
+ * Cola monótona: guarda solo los valores que todavía pueden ser el máximo,
+ * de mayor a menor. Cada valor entra y sale de la cola una vez, así que
+ * push cuesta O(1) amortizado. La cola es un anillo de window posiciones
+ * reservado al construir: push no reserva memoria.
+ */
+template <typename T>
+class SlidingMax {
+    static_assert(isSupported<T>, "stream_stats: tipo no soportado por max_reduce");
+
+public:
+    explicit SlidingMax(std::size_t window) : window_(window), values_(window), positions_(window) {
+        if (window == 0) throw std::invalid_argument{"SlidingMax: la ventana no puede ser 0"};
+    }
+
+    void push(T value) {
+        const std::uint64_t position = count_++;
+        // Sale por delante lo que ya no está en la ventana.
+        if (size_ != 0 && positions_[head_] + window_ <= position) popFront();
+        if (detail::isNaN(value)) return;
+        // Sale por detrás lo que value ya supera: nunca volverá a ser el máximo.
+        while (size_ != 0 && !(values_[slot(size_ - 1)] > value)) --size_;
+        const std::size_t tail = slot(size_);
+        values_[tail] = value;
+        positions_[tail] = position;
+        ++size_;
+    }
+
+    /// Como push de cada valor, pero de un bloque mayor que la ventana solo se miran los últimos window.
+    void pushBatch(const T* values, std::size_t count) {
+        if (count > window_) {
+            count_ += count - window_;
+            values += count - window_;
+            count = window_;
+            head_ = 0;
+            size_ = 0;
+        }
+        for (std::size_t i = 0; i < count; ++i) push(values[i]);
+    }
+
+    /// Vacío si en la ventana no hay ningún valor (o solo NaN).
+    std::optional<T> max() const { return size_ != 0 ? std::optional<T>{values_[head_]} : std::nullopt; }
+
+    std::size_t window() const { return window_; }
+    std::uint64_t count() const { return count_; }
+
+private:
+    std::size_t slot(std::size_t offset) const {
+        const std::size_t index = head_ + offset;
+        return index < window_ ? index : index - window_;
+    }
+
+    void popFront() {
+        head_ = slot(1);
+        --size_;
+    }
+
+    std::size_t window_;
+    std::vector<T> values_;
+    std::vector<std::uint64_t> positions_;
+    std::size_t head_{0};
+    std::size_t size_{0};
+    std::uint64_t count_{0};
+};
+
+/**
+ * @class TopK
+ * @brief Los k mayores valores vistos hasta ahora (con repeticiones).
+ *
+ * Montículo de mínimos con k elementos: la raíz es el umbral que hay que
+ * superar para entrar. Con el montículo lleno, pushBatch calcula el máximo
+ * de cada trozo de 256 valores con max_reduce y solo recorre uno a uno los
+ * trozos que lo superan; en un flujo largo casi ninguno.
+ */
+template <typename T>
+class TopK {
+    static_assert(isSupported<T>, "stream_stats: tipo no soportado por max_reduce");
+
+public:
+    explicit TopK(std::size_t k) : k_(k) {
+        if (k == 0) throw std::invalid_argument{"TopK: k no puede ser 0"};
+        heap_.reserve(k);
+    }
+
+    void push(T value) {
+        ++count_;
+        if (heap_.size() == k_) {
+            if (!(value > heap_.front())) return; // también descarta NaN
+            std::pop_heap(heap_.begin(), heap_.end(), std::greater<T>{});
+            heap_.back() = value;
+            std::push_heap(heap_.begin(), heap_.end(), std::greater<T>{});
+        } else if (!detail::isNaN(value)) {
+            heap_.push_back(value);
+            std::push_heap(heap_.begin(), heap_.end(), std::greater<T>{});
+        }
+    }
+
+    void pushBatch(const T* values, std::size_t count) {
+        std::size_t i = 0;
+        for (; i < count && heap_.size() < k_; ++i) push(values[i]);
+        constexpr std::size_t chunk = 256;
+        while (i < count) {
+            const std::size_t size = std::min(chunk, count - i);
+            if (max_reduce::maxValue(values + i, size) > heap_.front()) {
+                for (std::size_t j = 0; j < size; ++j) push(values[i + j]);
+            } else {
+                count_ += size;
+            }
+            i += size;
+        }
+    }
+
+    /// Los mayores, de mayor a menor (menos de k si aún no han llegado k valores).
+    std::vector<T> values() const {
+        std::vector<T> sorted = heap_;
+        std::sort(sorted.begin(), sorted.end(), std::greater<T>{});
+        return sorted;
+    }
+
+    /// El menor de los k mayores: lo que hay que superar para entrar.
+    std::optional<T> threshold() const {
+        return heap_.size() == k_ ? std::optional<T>{heap_.front()} : std::nullopt;
+    }
+
+    std::size_t k() const { return k_; }
+    std::uint64_t count() const { return count_; }
+
+private:
+    std::size_t k_;
+    std::vector<T> heap_;
+    std::uint64_t count_{0};
+};
+
+/**
+ * @class StreamStats
+ * @brief Las tres estadísticas a la vez sobre el mismo flujo.
+ *
+ * @code
+ * stream_stats::StreamStats<int> stats{1000, 10};   // ventana de 1000, los 10 mayores
+ * int number{};
+ * while (std::cin >> number) stats.push(number);
+ * std::cout << "El mayor es: " << *stats.max() << std::endl;
+ * @endcode
+ */
+template <typename T>
+class StreamStats {
+public:
+    StreamStats(std::size_t window, std::size_t k) : window_(window), top_(k) { }
+
+    void push(T value) {
+        running_.push(value);
+        window_.push(value);
+        top_.push(value);
+    }
+
+    void pushBatch(const T* values, std::size_t count) {
+        running_.pushBatch(values, count);
+        window_.pushBatch(values, count);
+        top_.pushBatch(values, count);
+    }
+
+    std::optional<T> max() const { return running_.max(); }
+    std::optional<T> windowMax() const { return window_.max(); }
+    std::vector<T> topK() const { return top_.values(); }
+    std::uint64_t count() const { return running_.count(); }
+
+private:
+    RunningMax<T> running_;
+    SlidingMax<T> window_;
+    TopK<T> top_;
+};
+
+} // namespace stream_stats
+
+#endif // STREAM_STATS_H
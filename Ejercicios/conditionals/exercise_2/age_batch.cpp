@@ -0,0 +1,321 @@
+#include "age_batch.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Mismos caracteres que salta std::ws en la locale "C".
+constexpr std::array<bool, 256> makeSpaceTable() {
+    std::array<bool, 256> table{};
+    for (const unsigned char c : {' ', '\n', '\t', '\r', '\v', '\f'}) table[c] = true;
+    return table;
+}
+constexpr std::array<bool, 256> spaceTable = makeSpaceTable();
+
+bool isSpace(char c) {
+    return spaceTable[static_cast<unsigned char>(c)];
+}
+
+// ----------------------------
+// Clasificación sin saltos
+// ----------------------------
+// 0 menor, 1 adulto, 2 inválida: dos comparaciones y aritmética, sin if.
+// (adulto | inválida << 1) da 3 si es a la vez >= mínimo y > máximo; restar
+// (adulto & inválida) lo deja en 2.
+template <typename Int>
+unsigned categoryCode(Int age, Int minAge, Int maxAge) {
+    const unsigned invalid = static_cast<unsigned>(age < 0) | static_cast<unsigned>(age > maxAge);
+    const unsigned adult = static_cast<unsigned>(age >= minAge);
+    return (adult | invalid << 1) - (adult & invalid);
+}
+
+// ----------------------------
+// SWAR: valor de un token corto
+// ----------------------------
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define AGE_BATCH_SWAR 1
+
+std::uint64_t load8(const char* text) {
+    std::uint64_t chunk{};
+    std::memcpy(&chunk, text, sizeof(chunk));
+    return chunk;
+}
+
+// Con x = chunk ^ '0' los dígitos quedan en 0..9; x + 0x76 pone el bit alto
+// en cuanto x >= 10. Los acarreos solo afectan a bytes posteriores al primer
+// no dígito, que es el único que interesa.
+std::uint64_t nonDigitMask(std::uint64_t digits) {
+    return ((digits + 0x7676767676767676ull) | digits) & 0x8080808080808080ull;
+}
+
+// Bytes que ocupa un token de 0 a 3 caracteres.
+constexpr std::uint64_t tokenBytes[4] = {0, 0xFFull, 0xFFFFull, 0xFFFFFFull};
+
+// Clave de 1 a 3 dígitos: un dígito por byte, el más significativo arriba y
+// ceros a la izquierda. Comparar claves es comparar los números, sin
+// convertirlos: "7" = 0x07 < "42" = 0x0402 < "100" = 0x010000.
+std::int64_t shortKey(std::uint64_t digits, unsigned length) {
+    return static_cast<std::int64_t>(__builtin_bswap64(digits & tokenBytes[length]) >> (64 - 8 * length));
+}
+#endif
+
+// ----------------------------
+// SSE2: espacios de 64 bytes en una máscara
+// ----------------------------
+// Con la posición de todos los separadores de la ventana, los tokens se
+// recorren quitando bits de la máscara: el siguiente token no depende de
+// haber terminado de leer el anterior.
+#if defined(AGE_BATCH_SWAR) && defined(__SSE2__)
+#define AGE_BATCH_SSE2 1
+
+std::uint64_t spaceMask64(const char* text) {
+    const __m128i blank = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i range = _mm_set1_epi8('\r' - '\t');
+    const __m128i zero = _mm_setzero_si128();
+    std::uint64_t mask{0};
+    for (int i = 0; i < 4; ++i) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 16 * i));
+        // '\t'..'\r' son consecutivos: byte - '\t' <= 4 sin signo.
+        const __m128i control = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(bytes, tab), range), zero);
+        const __m128i space = _mm_or_si128(control, _mm_cmpeq_epi8(bytes, blank));
+        mask |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(space))) << (16 * i);
+    }
+    return mask;
+}
+#endif
+
+// Recuento a partir de códigos ya escritos (0, 1 o 2): un byte por edad en
+// lugar de volver a leer los cuatro de cada int32_t.
+AgeCounts countCodes(const AgeCategory* codes, std::size_t count) {
+    std::uint64_t adults{0};
+    std::uint64_t invalid{0};
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto code = static_cast<unsigned>(codes[i]);
+        adults += code & 1;
+        invalid += code >> 1;
+    }
+    AgeCounts counts{};
+    counts.adults = adults;
+    counts.invalid = invalid;
+    counts.minors = count - adults - invalid;
+    return counts;
+}
+
+} // namespace
+
+AgeBatch::AgeBatch(const Functions& rules, std::size_t blockSize)
+    : rules_(rules),
+      minAge_(rules.minAge()),
+      maxAge_(rules.maxAge()),
+      minKey_(ageKey(minAge_)),
+      maxKey_(ageKey(maxAge_)),
+      blockSize_(std::max<std::size_t>(blockSize, 64)) { }
+
+// Clave de la misma forma que shortKey. Fuera de 0..999 se satura: ninguna
+// edad de 3 dígitos es menor que 0 ni mayor que 999, y -1 deja todas fuera.
+std::int64_t AgeBatch::ageKey(int age) {
+    if (age < 0) return -1;
+    if (age > 999) return 0x090909 + 1;
+    return (age / 100) << 16 | (age / 10 % 10) << 8 | age % 10;
+}
+
+// Camino lento: signo, números largos y basura. "+5" se acepta como cin >> int.
+AgeCategory AgeBatch::classifyToken(std::string_view token) const {
+    const char* first = token.data();
+    const char* last = first + token.size();
+    const bool negative = first != last && *first == '-';
+    if (first != last && (*first == '+' || *first == '-')) ++first;
+    if (first == last || !std::all_of(first, last, [](char c) { return c >= '0' && c <= '9'; })) {
+        return AgeCategory::Malformed;
+    }
+    long long age{};
+    const auto [end, error] = std::from_chars(first, last, age);
+    if (error != std::errc{} || end != last) return AgeCategory::Invalid; // solo dígitos: no cabe
+    return static_cast<AgeCategory>(categoryCode<long long>(negative ? -age : age, minAge_, maxAge_));
+}
+
+// Los contadores solo suman bits del código: adultos el bit 0 e inválidas el
+// bit 1. Mal formado (3) suma en los dos y se descuenta al final; así el
+// camino rápido no tiene ni un if por categoría.
+template <bool WithCodes>
+std::size_t AgeBatch::scanText(const char* first, const char* last, AgeCounts& counts, AgeCategory* codes) const {
+    std::uint64_t records{0};
+    std::uint64_t adults{0};
+    std::uint64_t invalid{0};
+    std::uint64_t malformed{0};
+    auto tally = [&](unsigned code) {
+        if constexpr (WithCodes) codes[records] = static_cast<AgeCategory>(code);
+        ++records;
+        adults += code & 1;
+        invalid += code >> 1;
+    };
+    auto classifySlow = [&](const char* begin, const char* end) {
+        const auto code = static_cast<unsigned>(classifyToken(std::string_view{begin, static_cast<std::size_t>(end - begin)}));
+        malformed += code == 3;
+        return code;
+    };
+
+    const char* p = first;
+#ifdef AGE_BATCH_SSE2
+    // Ventanas de 64 bytes mientras quepa además la lectura de 8 bytes del
+    // token más a la derecha. Un token que cruza la ventana empieza en tokenStart.
+    const char* tokenStart = p;
+    std::uint64_t previousInToken{0};
+    while (last - p >= 64 + 8) {
+        const std::uint64_t inToken = ~spaceMask64(p);
+        const std::uint64_t shifted = inToken << 1 | previousInToken;
+        std::uint64_t starts = inToken & ~shifted;
+        std::uint64_t ends = ~inToken & shifted;
+        previousInToken = inToken >> 63;
+        while (ends != 0) {
+            const char* end = p + __builtin_ctzll(ends);
+            ends &= ends - 1;
+            if (starts != 0 && p + __builtin_ctzll(starts) < end) {
+                tokenStart = p + __builtin_ctzll(starts);
+                starts &= starts - 1;
+            }
+            // 1 a 3 dígitos: una lectura de 8 bytes y se compara la clave.
+            const auto length = static_cast<unsigned>(end - tokenStart);
+            const std::uint64_t digits = load8(tokenStart) ^ 0x3030303030303030ull;
+            if (length <= 3 && (nonDigitMask(digits) & tokenBytes[length]) == 0) {
+                tally(categoryCode(shortKey(digits, length), minKey_, maxKey_));
+            } else {
+                tally(classifySlow(tokenStart, end));
+            }
+        }
+        if (starts != 0) tokenStart = p + __builtin_ctzll(starts);
+        p += 64;
+    }
+    if (previousInToken != 0) p = tokenStart;
+#endif
+
+    // Resto (o todo, sin SSE2): token a token.
+    while (true) {
+        while (p < last && isSpace(*p)) ++p;
+        if (p == last) break;
+        const char* end = p;
+        while (end < last && !isSpace(*end)) ++end;
+        tally(classifySlow(p, end));
+        p = end;
+    }
+
+    adults -= malformed;
+    invalid -= malformed;
+    counts.adults += adults;
+    counts.invalid += invalid;
+    counts.malformed += malformed;
+    counts.minors += records - adults - invalid - malformed;
+    return records;
+}
+
+AgeCounts AgeBatch::classifyText(std::string_view text, std::vector<AgeCategory>* codes) const {
+    AgeCounts counts{};
+    if (codes == nullptr) {
+        scanText<false>(text.data(), text.data() + text.size(), counts, nullptr);
+        return counts;
+    }
+    // Cada registro ocupa al menos un carácter y un separador.
+    const std::size_t before = codes->size();
+    codes->resize(before + text.size() / 2 + 1);
+    const std::size_t records = scanText<true>(text.data(), text.data() + text.size(), counts, codes->data() + before);
+    codes->resize(before + records);
+    return counts;
+}
+
+// Las edades ya son enteros: lo hacen los kernels por lotes de Functions.
+// Con códigos, el recuento sale de ellos y las edades se leen una sola vez.
+AgeCounts AgeBatch::classifyBinary(const std::int32_t* ages, std::size_t count, AgeCategory* codes) const {
+    if (codes == nullptr) return rules_.countCategories(ages, count);
+    rules_.esAdult(ages, count, codes);
+    return countCodes(codes, count);
+}
+
+// ----------------------------
+// Ficheros
+// ----------------------------
+AgeCounts AgeBatch::classifyFile(std::FILE* in, Format format, std::FILE* out) {
+    return format == Format::Text ? classifyTextFile(in, out) : classifyBinaryFile(in, out);
+}
+
+// Cada bloque se corta tras el último espacio: el token incompleto del final
+// pasa al principio del bloque siguiente.
+AgeCounts AgeBatch::classifyTextFile(std::FILE* in, std::FILE* out) {
+    AgeCounts counts{};
+    std::size_t pending{0};
+    while (true) {
+        if (buffer_.size() < pending + blockSize_) buffer_.resize(pending + blockSize_);
+        const std::size_t read = std::fread(buffer_.data() + pending, 1, blockSize_, in);
+        const std::size_t size = pending + read;
+        if (size == 0) break;
+
+        std::size_t cut = size;
+        if (read != 0) {
+            while (cut > 0 && !isSpace(buffer_[cut - 1])) --cut;
+        }
+        // Un token más largo que todo el bloque: se sigue leyendo.
+        if (cut == 0) {
+            pending = size;
+            continue;
+        }
+
+        if (out != nullptr) {
+            if (codes_.size() < cut / 2 + 1) codes_.resize(cut / 2 + 1);
+            writeCodes(out, scanText<true>(buffer_.data(), buffer_.data() + cut, counts, codes_.data()));
+        } else {
+            scanText<false>(buffer_.data(), buffer_.data() + cut, counts, nullptr);
+        }
+        pending = size - cut;
+        std::memmove(buffer_.data(), buffer_.data() + cut, pending);
+        if (read == 0) break;
+    }
+    return counts;
+}
+
+AgeCounts AgeBatch::classifyBinaryFile(std::FILE* in, std::FILE* out) {
+    AgeCounts counts{};
+    const std::size_t capacity = blockSize_ / sizeof(std::int32_t);
+    std::vector<std::int32_t> ages(capacity);
+    if (out != nullptr && codes_.size() < capacity) codes_.resize(capacity);
+
+    std::size_t pending{0}; // bytes de un int32_t incompleto
+    while (true) {
+        const std::size_t read = std::fread(reinterpret_cast<char*>(ages.data()) + pending, 1,
+                                            capacity * sizeof(std::int32_t) - pending, in);
+        const std::size_t bytes = pending + read;
+        if (read == 0) {
+            // Un int32_t a medias al final del fichero.
+            if (bytes != 0) {
+                ++counts.malformed;
+                if (out != nullptr) {
+                    codes_[0] = AgeCategory::Malformed;
+                    writeCodes(out, 1);
+                }
+            }
+            break;
+        }
+        const std::size_t count = bytes / sizeof(std::int32_t);
+        counts += classifyBinary(ages.data(), count, out != nullptr ? codes_.data() : nullptr);
+        if (out != nullptr) writeCodes(out, count);
+        pending = bytes % sizeof(std::int32_t);
+        std::memmove(ages.data(), ages.data() + count, pending);
+    }
+    return counts;
+}
+
+void AgeBatch::writeCodes(std::FILE* out, std::size_t count) {
+    if (count == 0) return; // lines_ puede seguir vacío: fwrite no admite nullptr
+    if (lines_.size() < count * 2) lines_.resize(count * 2);
+    for (std::size_t i = 0; i < count; ++i) {
+        lines_[2 * i] = static_cast<char>('0' + static_cast<unsigned>(codes_[i]));
+        lines_[2 * i + 1] = '\n';
+    }
+    std::fwrite(lines_.data(), 1, count * 2, out);
+}
@@ -0,0 +1,78 @@
+#ifndef AGE_BATCH_H
+#define AGE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+#include "functions.h"
+
+/**
+ * @class AgeBatch
+ * @brief Aplica la regla de Functions::esAdult a millones de edades.
+ *
+ * Lee por bloques grandes y clasifica sin saltos: cada edad se convierte en
+ * dos comparaciones cuyos resultados se suman, en lugar de un if por
+ * categoría. En texto, las edades de 1 a 3 dígitos (casi todas) se convierten
+ * con una sola lectura de 8 bytes; el resto pasa por std::from_chars.
+ *
+ * Formatos de entrada:
+ * - Text: enteros separados por espacios o saltos de línea. "-5" o "500" son
+ *   edades inválidas; "abc" o "12a" son Malformed.
+ * - Binary: int32_t consecutivos en el orden de bytes de la máquina.
+ *
+ * Salida opcional por registro: una línea con el código de su categoría
+ * (0 menor, 1 adulto, 2 inválida, 3 mal formada), en el orden de entrada.
+ */
+class AgeBatch {
+public:
+    enum class Format { Text, Binary };
+
+    /// Tamaño de bloque por defecto.
+    static constexpr std::size_t defaultBlockSize = std::size_t{1} << 20;
+
+    /**
+     * @param rules Edad mínima y máxima (se copian).
+     * @param blockSize Bytes de cada lectura.
+     */
+    explicit AgeBatch(const Functions& rules, std::size_t blockSize = defaultBlockSize);
+
+    /**
+     * @brief Clasifica todo el fichero in.
+     * @param out Si no es nullptr, recibe una línea por registro. Ningún
+     *        fichero se cierra.
+     */
+    AgeCounts classifyFile(std::FILE* in, Format format, std::FILE* out = nullptr);
+
+    /**
+     * @brief Clasifica un texto en memoria.
+     * @param codes Si no es nullptr, se le añade la categoría de cada registro.
+     */
+    AgeCounts classifyText(std::string_view text, std::vector<AgeCategory>* codes = nullptr) const;
+
+    /// Clasifica edades ya en memoria. codes, si no es nullptr, debe tener sitio para count.
+    AgeCounts classifyBinary(const std::int32_t* ages, std::size_t count, AgeCategory* codes = nullptr) const;
+
+private:
+    template <bool WithCodes>
+    std::size_t scanText(const char* first, const char* last, AgeCounts& counts, AgeCategory* codes) const;
+    AgeCategory classifyToken(std::string_view token) const;
+    static std::int64_t ageKey(int age);
+
+    AgeCounts classifyTextFile(std::FILE* in, std::FILE* out);
+    AgeCounts classifyBinaryFile(std::FILE* in, std::FILE* out);
+    void writeCodes(std::FILE* out, std::size_t count);
+
+    Functions rules_;
+    int minAge_;
+    int maxAge_;
+    std::int64_t minKey_; // minAge_ y maxAge_ como claves de dígitos (ver age_batch.cpp)
+    std::int64_t maxKey_;
+    std::size_t blockSize_;
+    std::vector<char> buffer_;
+    std::vector<AgeCategory> codes_;
+    std::vector<char> lines_;
+};
+
+#endif // AGE_BATCH_H
@@ -0,0 +1,192 @@
+#ifndef AGE_KERNELS_H
+#define AGE_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "functions.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AGE_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @namespace age_kernels
+ * @brief Kernels por lotes de esAdult, compartidos por Functions y StaticFunctions.
+ *
+ * Son plantillas sobre Limits, que da minAge() y maxAge(): Functions los
+ * instancia con los umbrales leídos en tiempo de ejecución (RuntimeLimits) y
+ * StaticFunctions con constantes (StaticLimits), que el compilador pliega
+ * dentro del bucle.
+ */
+namespace age_kernels {
+
+struct RuntimeLimits {
+    int min;
+    int max;
+    int minAge() const { return min; }
+    int maxAge() const { return max; }
+};
+
+template <int MinAge, int MaxAge>
+struct StaticLimits {
+    static constexpr int minAge() { return MinAge; }
+    static constexpr int maxAge() { return MaxAge; }
+};
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+// Las dos comparaciones de esAdult sin if: inválida vale 2 y manda sobre
+// adulto (1); menor es lo que queda (0).
+template <typename Limits>
+inline unsigned categoryCode(int age, const Limits& limits) {
+    const unsigned invalid = static_cast<unsigned>(age < 0) | static_cast<unsigned>(age > limits.maxAge());
+    const unsigned adult = static_cast<unsigned>(age >= limits.minAge()) & ~invalid;
+    return invalid << 1 | adult;
+}
+
+template <typename Limits>
+void classifyScalar(const int* ages, std::size_t count, const Limits& limits, AgeCategory* codes) {
+    for (std::size_t i = 0; i < count; ++i) codes[i] = static_cast<AgeCategory>(categoryCode(ages[i], limits));
+}
+
+template <typename Limits>
+AgeCounts countScalar(const int* ages, std::size_t count, const Limits& limits) {
+    std::uint64_t adults{0};
+    std::uint64_t invalid{0};
+    for (std::size_t i = 0; i < count; ++i) {
+        const unsigned code = categoryCode(ages[i], limits);
+        adults += code & 1;
+        invalid += code >> 1;
+    }
+    AgeCounts counts{};
+    counts.adults = adults;
+    counts.invalid = invalid;
+    counts.minors = count - adults - invalid;
+    return counts;
+}
+
+#ifdef AGE_KERNELS_X86
+
+// ----------------------------
+// Kernel AVX2
+// ----------------------------
+// Máscaras de 8 edades: todo unos donde se cumple la condición.
+struct Masks {
+    __m256i invalid;
+    __m256i adult; // ya sin las inválidas
+};
+
+__attribute__((target("avx2"), always_inline)) inline
+Masks categoryMasks(__m256i ages, __m256i minMinusOne, __m256i maxAge) {
+    const __m256i invalid = _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), ages),
+                                            _mm256_cmpgt_epi32(ages, maxAge));
+    // age >= minAge es age > minAge - 1 (minAge - 1 no desborda: se satura abajo).
+    const __m256i adult = _mm256_andnot_si256(invalid, _mm256_cmpgt_epi32(ages, minMinusOne));
+    return Masks{invalid, adult};
+}
+
+// minAge - 1 sin desbordar con INT_MIN: con INT_MIN todas las edades son
+// >= minAge, y minAge - 1 = INT_MIN solo dejaría fuera a INT_MIN, que ya es
+// inválida por negativa.
+constexpr int belowMin(int minAge) {
+    return minAge == INT32_MIN ? minAge : minAge - 1;
+}
+
+// Códigos de 8 edades, uno por carril de 32 bits.
+__attribute__((target("avx2"), always_inline)) inline
+__m256i codes8(const int* block, __m256i minMinusOne, __m256i maxAge) {
+    const Masks masks = categoryMasks(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)), minMinusOne, maxAge);
+    return _mm256_or_si256(_mm256_and_si256(masks.invalid, _mm256_set1_epi32(2)),
+                           _mm256_and_si256(masks.adult, _mm256_set1_epi32(1)));
+}
+
+__attribute__((target("avx2"))) inline
+std::uint64_t horizontalSum(__m256i lanes) {
+    alignas(32) std::uint32_t values[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(values), lanes);
+    std::uint64_t sum{0};
+    for (const std::uint32_t value : values) sum += value;
+    return sum;
+}
+
+template <typename Limits>
+__attribute__((target("avx2")))
+void classifyAvx2(const int* ages, std::size_t count, const Limits& limits, AgeCategory* codes) {
+    const __m256i minMinusOne = _mm256_set1_epi32(belowMin(limits.minAge()));
+    const __m256i maxLimit = _mm256_set1_epi32(limits.maxAge());
+    // packs intercala carriles de 128 bits; esta permutación los reordena.
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i low = _mm256_packs_epi32(codes8(ages + i, minMinusOne, maxLimit),
+                                               codes8(ages + i + 8, minMinusOne, maxLimit));
+        const __m256i high = _mm256_packs_epi32(codes8(ages + i + 16, minMinusOne, maxLimit),
+                                                codes8(ages + i + 24, minMinusOne, maxLimit));
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(low, high), order);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(codes + i), bytes);
+    }
+    classifyScalar(ages + i, count - i, limits, codes + i);
+}
+
+template <typename Limits>
+__attribute__((target("avx2")))
+AgeCounts countAvx2(const int* ages, std::size_t count, const Limits& limits) {
+    const __m256i minMinusOne = _mm256_set1_epi32(belowMin(limits.minAge()));
+    const __m256i maxLimit = _mm256_set1_epi32(limits.maxAge());
+
+    // Contadores de 32 bits por carril: restar la máscara (-1) suma 1. Se
+    // vacían a 64 bits antes de que puedan desbordar.
+    constexpr std::size_t flushEvery = std::size_t{1} << 30;
+    std::uint64_t adults{0};
+    std::uint64_t invalid{0};
+
+    std::size_t i = 0;
+    while (i + 8 <= count) {
+        const std::size_t stop = count - i > flushEvery ? i + flushEvery : count;
+        __m256i adultLanes = _mm256_setzero_si256();
+        __m256i invalidLanes = _mm256_setzero_si256();
+        for (; i + 8 <= stop; i += 8) {
+            const Masks masks = categoryMasks(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ages + i)),
+                                              minMinusOne, maxLimit);
+            adultLanes = _mm256_sub_epi32(adultLanes, masks.adult);
+            invalidLanes = _mm256_sub_epi32(invalidLanes, masks.invalid);
+        }
+        adults += horizontalSum(adultLanes);
+        invalid += horizontalSum(invalidLanes);
+    }
+
+    AgeCounts counts = countScalar(ages + i, count - i, limits);
+    counts.adults += adults;
+    counts.invalid += invalid;
+    counts.minors += i - adults - invalid;
+    return counts;
+}
+
+#endif // AGE_KERNELS_X86
+
+// Eligen el kernel que tenga activo Functions (ver Functions::forceKernel).
+template <typename Limits>
+void classify(const int* ages, std::size_t count, const Limits& limits, AgeCategory* codes) {
+#ifdef AGE_KERNELS_X86
+    if (Functions::activeKernel() == Functions::Kernel::Avx2) {
+        classifyAvx2(ages, count, limits, codes);
+        return;
+    }
+#endif
+    classifyScalar(ages, count, limits, codes);
+}
+
+template <typename Limits>
+AgeCounts countCategories(const int* ages, std::size_t count, const Limits& limits) {
+#ifdef AGE_KERNELS_X86
+    if (Functions::activeKernel() == Functions::Kernel::Avx2) return countAvx2(ages, count, limits);
+#endif
+    return countScalar(ages, count, limits);
+}
+
+} // namespace age_kernels
+
+#endif // AGE_KERNELS_H
@@ -0,0 +1,75 @@
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "age_batch.h"
+#include "functions.h"
+
+namespace {
+
+// El argumento entero debe ser un número: "abc" o "18x" no valen 0 ni 18.
+bool parseAge(const char* text, int& age) {
+    const char* last = text + std::strlen(text);
+    const auto [end, error] = std::from_chars(text, last, age);
+    return error == std::errc{} && end == last;
+}
+
+} // namespace
+
+// Modo por lotes: la misma regla que main.cpp sobre un fichero entero.
+//   ./batch edades.txt [--binary] [--output codigos.txt] [--min 18] [--max 120]
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " fichero [--binary] [--output fichero] [--min N] [--max N]\n";
+        return 1;
+    }
+
+    AgeBatch::Format format = AgeBatch::Format::Text;
+    const char* outputPath = nullptr;
+    int minAge = 18;
+    int maxAge = 120;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--binary") == 0) {
+            format = AgeBatch::Format::Binary;
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--min") == 0 && i + 1 < argc) {
+            if (!parseAge(argv[++i], minAge)) {
+                std::cerr << "Valor no válido para --min: " << argv[i] << '\n';
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+            if (!parseAge(argv[++i], maxAge)) {
+                std::cerr << "Valor no válido para --max: " << argv[i] << '\n';
+                return 1;
+            }
+        } else {
+            std::cerr << "Opción desconocida: " << argv[i] << '\n';
+            return 1;
+        }
+    }
+
+    std::FILE* in = std::fopen(argv[1], "rb");
+    if (in == nullptr) {
+        std::cerr << "No se puede abrir " << argv[1] << '\n';
+        return 1;
+    }
+    std::FILE* out = outputPath != nullptr ? std::fopen(outputPath, "wb") : nullptr;
+    if (outputPath != nullptr && out == nullptr) {
+        std::cerr << "No se puede crear " << outputPath << '\n';
+        std::fclose(in);
+        return 1;
+    }
+
+    AgeBatch batch{Functions{minAge, maxAge}};
+    const AgeCounts counts = batch.classifyFile(in, format, out);
+    std::fclose(in);
+    if (out != nullptr) std::fclose(out);
+
+    std::cout << "Menores de edad: " << counts.minors << '\n'
+              << "Mayores de edad: " << counts.adults << '\n'
+              << "Edades inválidas: " << counts.invalid << '\n'
+              << "Registros mal formados: " << counts.malformed << '\n'
+              << "Total: " << counts.total() << '\n';
+    return 0;
+}
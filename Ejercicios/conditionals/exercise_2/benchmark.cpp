@@ -0,0 +1,203 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "age_batch.h"
+#include "functions.h"
+#include "static_functions.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// ----------------------------
+// Benchmark: AgeBatch frente a esAdult en un bucle
+// ----------------------------
+// Genera N edades (la mayoría entre 0 y 100, algunas negativas o mayores de
+// 120) en texto, una por línea, y en binario (int32_t). La referencia es lo
+// que haría main.cpp repetido: ifstream >> int y esAdult por cada edad,
+// contando según el mensaje devuelto. Todas las variantes deben dar el mismo
+// recuento.
+//
+// Después, las versiones por lotes de Functions sobre edades ya en memoria,
+// en elementos por ciclo (ciclos del TSC, a frecuencia nominal): con 16 K
+// edades (en caché) y con todas. Las mismas funciones por elemento se miden
+// con Functions (umbrales en tiempo de ejecución) y con DefaultFunctions
+// (StaticFunctions<18, 120>, tabla constexpr): la misma plantilla sirve para
+// las dos.
+
+namespace {
+
+AgeCounts countWithEsAdult(const Functions& rules, int age, AgeCounts& counts) {
+    const char* message = rules.esAdult(age);
+    if (std::strcmp(message, "Es mayor de edad") == 0) {
+        ++counts.adults;
+    } else if (std::strcmp(message, "Menor de edad") == 0) {
+        ++counts.minors;
+    } else {
+        ++counts.invalid;
+    }
+    return counts;
+}
+
+template <typename F>
+void run(std::string_view name, std::size_t bytes, const AgeCounts& expected, F&& classify) {
+    const auto start = std::chrono::steady_clock::now();
+    const AgeCounts counts = classify();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const bool same = counts.minors == expected.minors && counts.adults == expected.adults &&
+                      counts.invalid == expected.invalid && counts.malformed == expected.malformed;
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << seconds * 1e3 << " ms" << std::setw(10) << bytes / seconds / 1e6 << " MB/s"
+              << (same ? "" : "   ¡RECUENTO DISTINTO!") << '\n';
+}
+
+std::uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+volatile std::uint64_t sink{};
+
+// Repite body hasta procesar unos 64 millones de edades.
+template <typename F>
+void runPerCycle(const std::string& name, std::size_t count, F&& body) {
+    const std::size_t repetitions = std::max<std::size_t>(1, 64'000'000 / count);
+    const std::uint64_t start = cycles();
+    for (std::size_t r = 0; r < repetitions; ++r) body();
+    const std::uint64_t elapsed = cycles() - start;
+    std::cout << "  " << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(8) << static_cast<double>(count * repetitions) / static_cast<double>(elapsed)
+              << " edades/ciclo\n";
+}
+
+template <typename Rules>
+void benchmarkPerElement(const std::string& name, const Rules& rules, const int* data, std::size_t count,
+                         std::vector<AgeCategory>& codes) {
+    runPerCycle(name + "::esAdult(int)", count, [&] {
+        std::uint64_t adults{0};
+        const char* adult = rules.esAdult(rules.minAge());
+        for (std::size_t i = 0; i < count; ++i) adults += rules.esAdult(data[i]) == adult;
+        sink = adults;
+    });
+    runPerCycle(name + "::category(int)", count, [&] {
+        for (std::size_t i = 0; i < count; ++i) codes[i] = rules.category(data[i]);
+        sink = static_cast<std::uint64_t>(codes[count / 2]);
+    });
+}
+
+void benchmarkKernels(const Functions& rules, const std::vector<std::int32_t>& ages, std::size_t count) {
+    std::cout << "\n" << count << " edades en memoria\n";
+    const int* data = ages.data();
+    std::vector<AgeCategory> codes(count);
+
+    benchmarkPerElement("Functions", rules, data, count, codes);
+    benchmarkPerElement("DefaultFunctions", DefaultFunctions{}, data, count, codes);
+    for (const Functions::Kernel kernel : {Functions::Kernel::Scalar, Functions::Kernel::Avx2}) {
+        if (!Functions::forceKernel(kernel)) continue;
+        const std::string suffix = std::string{" ("} + Functions::kernelName(kernel) + ")";
+        runPerCycle("esAdult(lote)" + suffix, count, [&] {
+            rules.esAdult(data, count, codes.data());
+            sink = static_cast<std::uint64_t>(codes[count / 2]);
+        });
+        runPerCycle("countCategories" + suffix, count, [&] { sink = rules.countCategories(data, count).adults; });
+    }
+    const DefaultFunctions staticRules{};
+    runPerCycle("DefaultFunctions::esAdult(lote)", count, [&] {
+        staticRules.esAdult(data, count, codes.data());
+        sink = static_cast<std::uint64_t>(codes[count / 2]);
+    });
+    runPerCycle("DefaultFunctions::countCategories", count, [&] { sink = staticRules.countCategories(data, count).adults; });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 50'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> usual{0, 100};
+    std::uniform_int_distribution<int> rare{-50, 1000};
+    std::vector<std::int32_t> ages(count);
+    for (auto& age : ages) age = rng() % 50 == 0 ? rare(rng) : usual(rng);
+
+    std::string text{};
+    text.reserve(count * 4);
+    for (const std::int32_t age : ages) text.append(std::to_string(age)).push_back('\n');
+
+    const std::string textPath = "age_batch_bench.txt";
+    const std::string binaryPath = "age_batch_bench.bin";
+    std::ofstream{textPath, std::ios::binary}.write(text.data(), static_cast<std::streamsize>(text.size()));
+    std::ofstream{binaryPath, std::ios::binary}
+        .write(reinterpret_cast<const char*>(ages.data()), static_cast<std::streamsize>(ages.size() * 4));
+
+    const Functions rules{};
+    AgeCounts expected{};
+    for (const std::int32_t age : ages) countWithEsAdult(rules, age, expected);
+    std::cout << count << " edades, texto " << text.size() / 1e6 << " MB, binario " << count * 4 / 1e6 << " MB\n";
+    std::cout << "menores " << expected.minors << ", adultos " << expected.adults << ", inválidas "
+              << expected.invalid << "\n\n";
+
+    const std::size_t textBytes = text.size();
+    const std::size_t binaryBytes = count * sizeof(std::int32_t);
+
+    run("texto: ifstream >> + esAdult", textBytes, expected, [&] {
+        AgeCounts counts{};
+        std::ifstream in{textPath};
+        int age{};
+        while (in >> age) countWithEsAdult(rules, age, counts);
+        return counts;
+    });
+    run("texto: AgeBatch fichero", textBytes, expected, [&] {
+        AgeBatch batch{rules};
+        std::FILE* in = std::fopen(textPath.c_str(), "rb");
+        const AgeCounts counts = batch.classifyFile(in, AgeBatch::Format::Text);
+        std::fclose(in);
+        return counts;
+    });
+    run("texto: AgeBatch fichero + salida", textBytes, expected, [&] {
+        AgeBatch batch{rules};
+        std::FILE* in = std::fopen(textPath.c_str(), "rb");
+        std::FILE* out = std::fopen("age_batch_codes.txt", "wb");
+        const AgeCounts counts = batch.classifyFile(in, AgeBatch::Format::Text, out);
+        std::fclose(in);
+        std::fclose(out);
+        return counts;
+    });
+    run("texto: AgeBatch en memoria", textBytes, expected, [&] { return AgeBatch{rules}.classifyText(text); });
+
+    run("binario: bucle esAdult", binaryBytes, expected, [&] {
+        AgeCounts counts{};
+        for (const std::int32_t age : ages) countWithEsAdult(rules, age, counts);
+        return counts;
+    });
+    run("binario: AgeBatch fichero", binaryBytes, expected, [&] {
+        AgeBatch batch{rules};
+        std::FILE* in = std::fopen(binaryPath.c_str(), "rb");
+        const AgeCounts counts = batch.classifyFile(in, AgeBatch::Format::Binary);
+        std::fclose(in);
+        return counts;
+    });
+    run("binario: AgeBatch en memoria", binaryBytes, expected, [&] {
+        return AgeBatch{rules}.classifyBinary(ages.data(), ages.size());
+    });
+
+    benchmarkKernels(rules, ages, std::min<std::size_t>(count, 16 * 1024));
+    benchmarkKernels(rules, ages, count);
+
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+    std::remove("age_batch_codes.txt");
+    return 0;
+}
@@ -1,11 +1,90 @@
 #include "functions.h"
+#include "age_kernels.h"
 
 Functions::Functions(int minAge, int maxAge)
     : minAge_(minAge), maxAge_(maxAge) { }
 
 const char* Functions::esAdult(int age) const {
+    return categoryMessage(category(age));
+}
+
+AgeCategory Functions::category(int age) const {
     if (age < 0 || age > maxAge_) {
-        return "Error: edad inválida";
+        return AgeCategory::Invalid;
     }
-    return (age >= minAge_) ? "Es mayor de edad" : "Menor de edad";
+    return (age >= minAge_) ? AgeCategory::Adult : AgeCategory::Minor;
+}
+
+AgeCounts& AgeCounts::operator+=(const AgeCounts& other) {
+    minors += other.minors;
+    adults += other.adults;
+    invalid += other.invalid;
+    malformed += other.malformed;
+    return *this;
+}
+
+namespace {
+
+using age_kernels::RuntimeLimits;
+
+struct Table {
+    void (*classify)(const int*, std::size_t, const RuntimeLimits&, AgeCategory*);
+    AgeCounts (*count)(const int*, std::size_t, const RuntimeLimits&);
+};
+
+constexpr Table scalarTable{age_kernels::classifyScalar<RuntimeLimits>, age_kernels::countScalar<RuntimeLimits>};
+#ifdef AGE_KERNELS_X86
+constexpr Table avx2Table{age_kernels::classifyAvx2<RuntimeLimits>, age_kernels::countAvx2<RuntimeLimits>};
+#endif
+
+bool supports(Functions::Kernel kernel) {
+#ifdef AGE_KERNELS_X86
+    if (kernel == Functions::Kernel::Avx2) return __builtin_cpu_supports("avx2");
+#endif
+    return kernel == Functions::Kernel::Scalar;
+}
+
+const Table& tableFor(Functions::Kernel kernel) {
+#ifdef AGE_KERNELS_X86
+    if (kernel == Functions::Kernel::Avx2) return avx2Table;
+#endif
+    return scalarTable;
+}
+
+struct Dispatch {
+    Functions::Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state = [] {
+        const Functions::Kernel best = supports(Functions::Kernel::Avx2) ? Functions::Kernel::Avx2
+                                                                         : Functions::Kernel::Scalar;
+        return Dispatch{best, &tableFor(best)};
+    }();
+    return state;
+}
+
+} // namespace
+
+void Functions::esAdult(const int* ages, std::size_t count, AgeCategory* codes) const {
+    dispatch().table->classify(ages, count, RuntimeLimits{minAge_, maxAge_}, codes);
+}
+
+AgeCounts Functions::countCategories(const int* ages, std::size_t count) const {
+    return dispatch().table->count(ages, count, RuntimeLimits{minAge_, maxAge_});
+}
+
+Functions::Kernel Functions::activeKernel() {
+    return dispatch().kernel;
+}
+
+bool Functions::forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* Functions::kernelName(Kernel kernel) {
+    return kernel == Kernel::Avx2 ? "AVX2" : "escalar";
 }
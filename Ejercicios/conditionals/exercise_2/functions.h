@@ -1,13 +1,82 @@
 #ifndef FUNCTIONS_H
 #define FUNCTIONS_H
 
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#include <stdexcept>
+#define FUNCTIONS_HAS_SPAN 1
+#endif
+
+// Categoría de una edad, en el mismo orden que los mensajes de esAdult.
+enum class AgeCategory : unsigned char {
+    Minor,    // "Menor de edad"
+    Adult,    // "Es mayor de edad"
+    Invalid,  // "Error: edad inválida"
+    Malformed // En lectura por lotes: el texto no era un número
+};
+
+// Mensaje de esAdult para cada categoría
+constexpr const char* categoryMessage(AgeCategory category) {
+    switch (category) {
+    case AgeCategory::Minor: return "Menor de edad";
+    case AgeCategory::Adult: return "Es mayor de edad";
+    case AgeCategory::Invalid: return "Error: edad inválida";
+    default: return "Error: no es un número";
+    }
+}
+
+// Recuento por categoría de un lote de edades
+struct AgeCounts {
+    std::uint64_t minors{0};
+    std::uint64_t adults{0};
+    std::uint64_t invalid{0};
+    std::uint64_t malformed{0}; // Solo en lectura por lotes
+
+    std::uint64_t total() const { return minors + adults + invalid + malformed; }
+    AgeCounts& operator+=(const AgeCounts& other);
+};
+
 class Functions {
 public:
+    // Implementaciones de las versiones por lotes, elegidas en tiempo de ejecución
+    enum class Kernel { Scalar, Avx2 };
+
     Functions(int minAge = 18, int maxAge = 120);
 
     // Devuelve un mensaje sobre la edad
     const char* esAdult(int age) const;
 
+    // La misma regla que esAdult, como categoría
+    AgeCategory category(int age) const;
+
+    // La misma regla para count edades seguidas: codes[i] = category(ages[i]),
+    // sin saltos (AVX2: 32 edades por paso)
+    void esAdult(const int* ages, std::size_t count, AgeCategory* codes) const;
+
+    // Solo cuenta cuántas hay de cada categoría, sin escribir códigos
+    AgeCounts countCategories(const int* ages, std::size_t count) const;
+
+#ifdef FUNCTIONS_HAS_SPAN
+    // Lanza std::invalid_argument si ages y codes no tienen el mismo tamaño
+    void esAdult(std::span<const int> ages, std::span<AgeCategory> codes) const {
+        if (ages.size() != codes.size()) {
+            throw std::invalid_argument{"esAdult: ages y codes deben tener el mismo tamaño"};
+        }
+        esAdult(ages.data(), ages.size(), codes.data());
+    }
+    AgeCounts countCategories(std::span<const int> ages) const { return countCategories(ages.data(), ages.size()); }
+#endif
+
+    int minAge() const { return minAge_; }
+    int maxAge() const { return maxAge_; }
+
+    static Kernel activeKernel();
+    static bool forceKernel(Kernel kernel);
+    static const char* kernelName(Kernel kernel);
+
 private:
     int minAge_;
     int maxAge_;
@@ -0,0 +1,88 @@
+#ifndef STATIC_FUNCTIONS_H
+#define STATIC_FUNCTIONS_H
+
+#include <array>
+#include <cstddef>
+#include "age_kernels.h"
+#include "functions.h"
+
+/**
+ * @class StaticFunctions
+ * @brief Functions con la edad mínima y máxima fijadas al compilar.
+ *
+ * Misma interfaz que Functions (esAdult, category, las versiones por lotes,
+ * minAge, maxAge), así que el código escrito como plantilla sobre "las
+ * reglas" funciona con las dos:
+ * @code
+ * template <typename Rules>
+ * void imprimir(const Rules& rules, int age) { std::cout << rules.esAdult(age); }
+ *
+ * imprimir(Functions{}, 20);          // umbrales en tiempo de ejecución
+ * imprimir(DefaultFunctions{}, 20);   // StaticFunctions<18, 120>
+ * @endcode
+ *
+ * category(age) es una sola lectura de una tabla constexpr de MaxAge + 2
+ * entradas (0..MaxAge y una última "inválida" para todo lo demás): el único
+ * cálculo es acotar el índice, sin saltos.
+ */
+template <int MinAge, int MaxAge>
+class StaticFunctions {
+    static_assert(MaxAge >= 0 && MaxAge <= 4095, "StaticFunctions: la tabla tiene MaxAge + 2 entradas");
+
+public:
+    // Devuelve un mensaje sobre la edad
+    constexpr const char* esAdult(int age) const { return categoryMessage(category(age)); }
+
+    // La misma regla que esAdult, como categoría
+    constexpr AgeCategory category(int age) const {
+        // Negativas y mayores que MaxAge van, en unsigned, por encima de MaxAge.
+        const auto index = static_cast<unsigned>(age);
+        return table_[index <= static_cast<unsigned>(MaxAge) ? index : MaxAge + 1u];
+    }
+
+    // Versiones por lotes: los kernels de Functions (escalar o AVX2, el que
+    // tenga activo Functions) instanciados con los umbrales como constantes
+    void esAdult(const int* ages, std::size_t count, AgeCategory* codes) const {
+        age_kernels::classify(ages, count, Limits{}, codes);
+    }
+    AgeCounts countCategories(const int* ages, std::size_t count) const {
+        return age_kernels::countCategories(ages, count, Limits{});
+    }
+
+#ifdef FUNCTIONS_HAS_SPAN
+    // Lanza std::invalid_argument si ages y codes no tienen el mismo tamaño
+    void esAdult(std::span<const int> ages, std::span<AgeCategory> codes) const {
+        if (ages.size() != codes.size()) {
+            throw std::invalid_argument{"esAdult: ages y codes deben tener el mismo tamaño"};
+        }
+        esAdult(ages.data(), ages.size(), codes.data());
+    }
+    AgeCounts countCategories(std::span<const int> ages) const { return countCategories(ages.data(), ages.size()); }
+#endif
+
+    static constexpr int minAge() { return MinAge; }
+    static constexpr int maxAge() { return MaxAge; }
+
+private:
+    using Limits = age_kernels::StaticLimits<MinAge, MaxAge>;
+
+    static constexpr std::array<AgeCategory, MaxAge + 2> makeTable() {
+        std::array<AgeCategory, MaxAge + 2> table{};
+        for (int age = 0; age <= MaxAge; ++age) table[age] = age >= MinAge ? AgeCategory::Adult : AgeCategory::Minor;
+        table[MaxAge + 1] = AgeCategory::Invalid;
+        return table;
+    }
+
+    static constexpr std::array<AgeCategory, MaxAge + 2> table_ = makeTable();
+};
+
+/// Las reglas por defecto de Functions, fijadas al compilar.
+using DefaultFunctions = StaticFunctions<18, 120>;
+
+static_assert(DefaultFunctions{}.category(17) == AgeCategory::Minor);
+static_assert(DefaultFunctions{}.category(18) == AgeCategory::Adult);
+static_assert(DefaultFunctions{}.category(120) == AgeCategory::Adult);
+static_assert(DefaultFunctions{}.category(121) == AgeCategory::Invalid);
+static_assert(DefaultFunctions{}.category(-1) == AgeCategory::Invalid);
+
+#endif // STATIC_FUNCTIONS_H
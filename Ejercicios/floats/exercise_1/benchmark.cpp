@@ -0,0 +1,115 @@
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <vector>
+#include "float_format.h"
+
+// ----------------------------
+// Benchmark: doubles por segundo
+// ----------------------------
+// Convierte los mismos doubles (bits aleatorios, solo finitos: todas las
+// magnitudes posibles) con printf("%.17g"), ostream con setprecision(17),
+// std::to_chars y float_format en sus tres modos. Antes se comprueba que
+// float_format vuelve a leerse con el mismo valor en todos los modos.
+
+namespace {
+
+volatile std::size_t sink{0};
+
+template <typename F>
+void run(std::string_view name, const std::vector<double>& values, F&& convert) {
+    std::size_t bytes{0};
+    const auto start = std::chrono::steady_clock::now();
+    for (const double value : values) bytes += convert(value);
+    const auto stop = std::chrono::steady_clock::now();
+    sink = sink + bytes;
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(1) << values.size() / seconds / 1e6 << " M/s"
+              << std::setw(10) << std::setprecision(1) << static_cast<double>(bytes) / values.size() << " bytes/valor\n";
+}
+
+void runAll(std::string_view title, const std::vector<double>& values) {
+    std::cout << title << '\n';
+    char buffer[float_format::maxChars<double>];
+
+    run("printf(\"%.17g\")", values, [&](double value) {
+        return static_cast<std::size_t>(std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+    });
+
+    std::ostringstream stream{};
+    stream << std::setprecision(17);
+    run("ostream setprecision(17)", values, [&](double value) {
+        stream.str(std::string{});
+        stream << value;
+        return static_cast<std::size_t>(stream.tellp());
+    });
+
+    run("std::to_chars", values, [&](double value) {
+        return static_cast<std::size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer);
+    });
+
+    run("float_format General", values, [&](double value) {
+        return static_cast<std::size_t>(float_format::format(buffer, buffer + sizeof(buffer), value) - buffer);
+    });
+
+    run("float_format Scientific", values, [&](double value) {
+        return static_cast<std::size_t>(
+            float_format::format(buffer, buffer + sizeof(buffer), value, float_format::Mode::Scientific) - buffer);
+    });
+
+    run("float_format Fixed", values, [&](double value) {
+        return static_cast<std::size_t>(
+            float_format::format(buffer, buffer + sizeof(buffer), value, float_format::Mode::Fixed) - buffer);
+    });
+
+    std::cout << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 2'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    std::vector<double> values{};
+    values.reserve(count);
+    std::mt19937_64 rng{7};
+    while (values.size() < count) {
+        const std::uint64_t bits = rng();
+        double value{};
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value)) values.push_back(value);
+    }
+
+    // Ida y vuelta: strtod(format(x)) == x, bit a bit.
+    std::size_t mismatches{0};
+    char buffer[float_format::maxChars<double> + 1];
+    for (const float_format::Mode mode : {float_format::Mode::General, float_format::Mode::Fixed,
+                                          float_format::Mode::Scientific}) {
+        for (std::size_t i = 0; i < values.size(); i += 16) {
+            char* end = float_format::format(buffer, buffer + float_format::maxChars<double>, values[i], mode);
+            *end = '\0';
+            const double back = std::strtod(buffer, nullptr);
+            if (std::memcmp(&back, &values[i], sizeof(back)) != 0) ++mismatches;
+        }
+    }
+    std::cout << "Ida y vuelta con strtod: " << mismatches << " diferencias\n\n";
+
+    runAll("Bits aleatorios (todas las magnitudes)", values);
+
+    // Valores cotidianos: importes con dos decimales.
+    for (double& value : values) value = static_cast<double>(rng() % 10'000'000) / 100.0;
+    runAll("Importes con dos decimales", values);
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "float_format.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace float_format {
+
+namespace {
+
+// ----------------------------
+// Dígitos más cortos
+// ----------------------------
+// value = d0.d1d2... × 10^exponent, con los dígitos más cortos que
+// reproducen value. Los calcula std::to_chars en formato científico (en
+// libstdc++ y MSVC es Ryu): aquí solo se separan dígitos y exponente, y la
+// colocación (Fixed / Scientific / General) la hacemos nosotros.
+struct Decimal {
+    char digits[24];
+    int count;
+    int exponent;
+};
+
+template <typename T>
+Decimal shortestDigits(T magnitude) {
+    char scratch[48];
+    const char* end = std::to_chars(scratch, scratch + sizeof(scratch), magnitude, std::chars_format::scientific).ptr;
+
+    Decimal decimal{};
+    const char* p = scratch;
+    for (; *p != 'e'; ++p) {
+        if (*p != '.') decimal.digits[decimal.count++] = *p;
+    }
+    ++p; // 'e'
+    const bool negativeExponent = *p++ == '-';
+    int exponent{0};
+    for (; p < end; ++p) exponent = exponent * 10 + (*p - '0');
+    decimal.exponent = negativeExponent ? -exponent : exponent;
+    return decimal;
+}
+
+int exponentDigits(int exponent) {
+    exponent = std::abs(exponent);
+    return exponent >= 100 ? 3 : 2;
+}
+
+std::size_t fixedLength(const Decimal& d) {
+    if (d.exponent >= d.count - 1) return static_cast<std::size_t>(d.exponent + 1);   // 12300
+    if (d.exponent >= 0) return static_cast<std::size_t>(d.count + 1);                // 12.3
+    return static_cast<std::size_t>(d.count + 1 - d.exponent);                        // 0.0123
+}
+
+std::size_t scientificLength(const Decimal& d) {
+    return static_cast<std::size_t>(d.count + (d.count > 1 ? 1 : 0) + 2 + exponentDigits(d.exponent));
+}
+
+char* writeFixed(char* out, const Decimal& d) {
+    if (d.exponent >= d.count - 1) {
+        std::memcpy(out, d.digits, static_cast<std::size_t>(d.count));
+        out += d.count;
+        const int zeros = d.exponent - (d.count - 1);
+        std::memset(out, '0', static_cast<std::size_t>(zeros));
+        return out + zeros;
+    }
+    if (d.exponent >= 0) {
+        const int integerDigits = d.exponent + 1;
+        std::memcpy(out, d.digits, static_cast<std::size_t>(integerDigits));
+        out += integerDigits;
+        *out++ = '.';
+        std::memcpy(out, d.digits + integerDigits, static_cast<std::size_t>(d.count - integerDigits));
+        return out + (d.count - integerDigits);
+    }
+    *out++ = '0';
+    *out++ = '.';
+    const int zeros = -d.exponent - 1;
+    std::memset(out, '0', static_cast<std::size_t>(zeros));
+    out += zeros;
+    std::memcpy(out, d.digits, static_cast<std::size_t>(d.count));
+    return out + d.count;
+}
+
+char* writeScientific(char* out, const Decimal& d) {
+    *out++ = d.digits[0];
+    if (d.count > 1) {
+        *out++ = '.';
+        std::memcpy(out, d.digits + 1, static_cast<std::size_t>(d.count - 1));
+        out += d.count - 1;
+    }
+    *out++ = 'e';
+    *out++ = d.exponent < 0 ? '-' : '+';
+    const int exponent = std::abs(d.exponent);
+    if (exponent >= 100) *out++ = static_cast<char>('0' + exponent / 100);
+    *out++ = static_cast<char>('0' + exponent / 10 % 10);
+    *out++ = static_cast<char>('0' + exponent % 10);
+    return out;
+}
+
+char* writeText(char* first, char* last, const char* text) {
+    const std::size_t length = std::strlen(text);
+    if (static_cast<std::size_t>(last - first) < length) return nullptr;
+    std::memcpy(first, text, length);
+    return first + length;
+}
+
+template <typename T>
+char* formatImpl(char* first, char* last, T value, Mode mode) {
+    const bool negative = std::signbit(value);
+    if (std::isnan(value)) return writeText(first, last, negative ? "-nan" : "nan");
+    if (std::isinf(value)) return writeText(first, last, negative ? "-inf" : "inf");
+
+    // El cero también pasa por aquí: to_chars da "0e+00" y el signo se
+    // añade aparte, así -0.0 sale como "-0".
+    const Decimal decimal = shortestDigits(negative ? -value : value);
+
+    if (mode == Mode::General) {
+        mode = fixedLength(decimal) <= scientificLength(decimal) ? Mode::Fixed : Mode::Scientific;
+    }
+    const std::size_t length = (negative ? 1 : 0) +
+                               (mode == Mode::Fixed ? fixedLength(decimal) : scientificLength(decimal));
+    if (static_cast<std::size_t>(last - first) < length) return nullptr;
+
+    if (negative) *first++ = '-';
+    return mode == Mode::Fixed ? writeFixed(first, decimal) : writeScientific(first, decimal);
+}
+
+template <typename T>
+std::string toStringImpl(T value, Mode mode) {
+    char buffer[maxChars<T>];
+    char* end = formatImpl(buffer, buffer + sizeof(buffer), value, mode);
+    return std::string{buffer, end};
+}
+
+} // namespace
+
+char* format(char* first, char* last, double value, Mode mode) {
+    return formatImpl(first, last, value, mode);
+}
+
+char* format(char* first, char* last, float value, Mode mode) {
+    return formatImpl(first, last, value, mode);
+}
+
+std::string toString(double value, Mode mode) {
+    return toStringImpl(value, mode);
+}
+
+std::string toString(float value, Mode mode) {
+    return toStringImpl(value, mode);
+}
+
+} // namespace float_format
@@ -0,0 +1,54 @@
+#ifndef FLOAT_FORMAT_H
+#define FLOAT_FORMAT_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @namespace float_format
+ * @brief Conversión de float y double a texto con el menor número de dígitos
+ *        que, al volver a leerse, da exactamente el mismo valor.
+ *
+ * 7-Floats.cpp usa setprecision(9) y setprecision(17) para ver que 0.1 no es
+ * exacto; aquí 0.1 se escribe "0.1" y 0.1 + 0.2 se escribe
+ * "0.30000000000000004": ni un dígito más de los necesarios.
+ *
+ * Todas las funciones escriben en un buffer del llamador, sin reservar memoria
+ * (salvo toString) y sin '\0' final.
+ */
+namespace float_format {
+
+/// Forma de colocar los dígitos.
+enum class Mode {
+    General,   ///< La más corta entre Fixed y Scientific (Fixed si empatan).
+    Fixed,     ///< Sin exponente: 1234.5, 0.00012
+    Scientific ///< Un dígito antes del punto y exponente de al menos 2 cifras: 1.2345e+03
+};
+
+/// Tamaño de buffer que basta para cualquier valor del tipo en cualquier modo.
+/// El peor caso es Fixed con el subnormal más pequeño ("0.000...0049...").
+template <typename T>
+constexpr std::size_t maxChars = 0;
+template <>
+constexpr std::size_t maxChars<float> = 64;
+template <>
+constexpr std::size_t maxChars<double> = 352;
+
+/**
+ * @brief Escribe value en [first, last).
+ * @return Puntero justo detrás del último carácter escrito, o nullptr si no
+ *         cabe (en ese caso el contenido de [first, last) es indeterminado).
+ *
+ * Valores especiales, igual que std::cout en 7-Floats.cpp: "inf", "-inf",
+ * "nan" o "-nan" según el bit de signo, y "0" / "-0" (con "e+00" en Scientific).
+ */
+char* format(char* first, char* last, double value, Mode mode = Mode::General);
+char* format(char* first, char* last, float value, Mode mode = Mode::General);
+
+/// Comodidad para cuando el rendimiento no importa.
+std::string toString(double value, Mode mode = Mode::General);
+std::string toString(float value, Mode mode = Mode::General);
+
+} // namespace float_format
+
+#endif // FLOAT_FORMAT_H
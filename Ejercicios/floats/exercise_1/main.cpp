@@ -0,0 +1,56 @@
+#include <iomanip>
+#include <string_view>
+#include <iostream>
+#include <limits>
+#include "float_format.h"
+
+// Los mismos valores que 7-Floats.cpp, comparando cout con setprecision y
+// float_format, que escribe solo los dígitos necesarios para volver a leer
+// exactamente el mismo valor.
+int main() {
+    using float_format::Mode;
+    using float_format::toString;
+
+    auto show = [](const char* label, double value) {
+        std::cout << std::left << std::setw(26) << label << std::right
+                  << std::setw(24) << toString(value)
+                  << std::setw(26) << toString(value, Mode::Scientific)
+                  << "   cout(17): " << std::setprecision(17) << value << '\n';
+    };
+
+    std::cout << std::left << std::setw(26) << "valor" << std::right << std::setw(24) << "General"
+              << std::setw(26) << "Scientific" << '\n';
+
+    show("5.0", 5.0);
+    show("9876543.21", 9876543.21);
+    show("0.1", 0.1);
+    show("0.1 * 10 (sumando)", 0.1 + 0.1 + 0.1 + 0.1 + 0.1 + 0.1 + 0.1 + 0.1 + 0.1 + 0.1);
+    show("0.1 + 0.2", 0.1 + 0.2);
+    show("1e21", 1e21);
+    show("double mínimo normal", std::numeric_limits<double>::min());
+    show("double máximo", std::numeric_limits<double>::max());
+
+    // float: el número más corto que lo identifica como float, no como double.
+    const float f2{123456789.0f};
+    std::cout << "\nfloat 123456789.0f: " << toString(f2) << "  (con 9 dígitos en cout: "
+              << std::setprecision(9) << f2 << ")\n";
+    std::cout << "6.7f: " << toString(6.7f) << "  (como double: " << toString(static_cast<double>(6.7f)) << ")\n";
+
+    // Valores especiales, como en la sección 8 de 7-Floats.cpp.
+    double zero{0.0};
+    const double posinf{5.0 / zero};
+    const double neginf{-5.0 / zero};
+    const double nan{zero / zero};
+    std::cout << "\nPositivo infinito: " << toString(posinf) << "   cout: " << posinf << '\n';
+    std::cout << "Negativo infinito: " << toString(neginf) << "   cout: " << neginf << '\n';
+    std::cout << "NaN: " << toString(nan) << "   cout: " << nan << '\n';
+    std::cout << "Cero positivo: " << toString(0.0 / posinf) << "   cout: " << 0.0 / posinf << '\n';
+    std::cout << "Cero negativo: " << toString(-0.0 / posinf) << "   cout: " << -0.0 / posinf << '\n';
+
+    // Escribir en un buffer propio: sin std::string ni memoria dinámica.
+    char buffer[float_format::maxChars<double>];
+    const char* end = float_format::format(buffer, buffer + sizeof(buffer), 1.5e-7, Mode::Fixed);
+    std::cout << "\n1.5e-7 en Fixed: " << std::string_view{buffer, static_cast<std::size_t>(end - buffer)} << '\n';
+
+    return 0;
+}
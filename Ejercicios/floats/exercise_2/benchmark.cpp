@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "decimal_parser.h"
+
+// ----------------------------
+// Benchmark: GB/s leyendo doubles
+// ----------------------------
+// Genera un CSV en memoria (8 columnas por línea, cada número con su
+// representación más corta) y lo lee con istream, strtod, std::from_chars,
+// decimal_parser::parse y decimal_parser::parseFields. La suma de todos los
+// valores debe coincidir.
+
+namespace {
+
+bool isSeparator(char c) {
+    return c == ',' || c == '\n';
+}
+
+template <typename F>
+void run(std::string_view name, const std::string& text, F&& readAll) {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t count{0};
+    const double sum = readAll(count);
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::setw(10) << count
+              << std::setw(26) << std::setprecision(17) << sum
+              << std::setw(10) << std::fixed << std::setprecision(2) << text.size() / seconds / 1e9 << " GB/s"
+              << std::setw(10) << std::setprecision(1) << count / seconds / 1e6 << " M/s\n"
+              << std::defaultfloat;
+}
+
+std::string makeCsv(std::size_t count, bool everyday) {
+    std::mt19937_64 rng{7};
+    std::string text{};
+    char buffer[32];
+    for (std::size_t i = 0; i < count; ++i) {
+        double value{};
+        if (everyday) {
+            value = static_cast<double>(rng() % 10'000'000) / 100.0; // importes con dos decimales
+        } else {
+            // Magnitudes entre 1e-30 y 1e30 con 17 dígitos significativos.
+            value = std::ldexp(static_cast<double>(rng() >> 11), static_cast<int>(rng() % 200) - 153);
+        }
+        text.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+        text.push_back(i % 8 == 7 ? '\n' : ',');
+    }
+    return text;
+}
+
+void runAll(std::string_view title, const std::string& text) {
+    std::cout << title << " (" << text.size() / 1e6 << " MB)\n";
+
+    run("istringstream >>", text, [&](std::size_t& count) {
+        std::istringstream in{text};
+        double sum{0};
+        double value{};
+        while (in >> value) {
+            sum += value;
+            ++count;
+            in.ignore(1); // ',' o '\n' (con >> char se saltaría el '\n' y se comería un dígito)
+        }
+        return sum;
+    });
+
+    run("strtod", text, [&](std::size_t& count) {
+        double sum{0};
+        const char* p = text.c_str();
+        char* end{};
+        while (*p != '\0') {
+            sum += std::strtod(p, &end);
+            ++count;
+            p = end + 1;
+        }
+        return sum;
+    });
+
+    run("std::from_chars", text, [&](std::size_t& count) {
+        double sum{0};
+        const char* p = text.data();
+        const char* last = text.data() + text.size();
+        while (p < last) {
+            double value{};
+            p = std::from_chars(p, last, value).ptr;
+            sum += value;
+            ++count;
+            while (p < last && isSeparator(*p)) ++p;
+        }
+        return sum;
+    });
+
+    run("decimal_parser::parse", text, [&](std::size_t& count) {
+        double sum{0};
+        const char* p = text.data();
+        const char* last = text.data() + text.size();
+        while (p < last) {
+            double value{};
+            p = decimal_parser::parse(p, last, value).ptr;
+            sum += value;
+            ++count;
+            while (p < last && isSeparator(*p)) ++p;
+        }
+        return sum;
+    });
+
+    // Con el sitio ya reservado se mide la lectura, no el crecimiento del vector.
+    std::vector<double> values{};
+    values.reserve(static_cast<std::size_t>(std::count_if(text.begin(), text.end(), isSeparator)));
+    run("decimal_parser::parseFields", text, [&](std::size_t& count) {
+        values.clear();
+        decimal_parser::parseFields(text, ',', values);
+        double sum{0};
+        for (const double value : values) sum += value;
+        count = values.size();
+        return sum;
+    });
+    std::cout << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 5'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    runAll("17 dígitos, exponentes variados", makeCsv(count, false));
+    runAll("Importes con dos decimales", makeCsv(count, true));
+    return 0;
+}
@@ -0,0 +1,676 @@
+#include "decimal_parser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace decimal_parser {
+
+namespace {
+
+// ----------------------------
+// Formato binario de cada tipo
+// ----------------------------
+// Constantes de Eisel-Lemire para IEEE 754 binary64 y binary32.
+template <typename T>
+struct Binary;
+
+template <>
+struct Binary<double> {
+    using Bits = std::uint64_t;
+    static constexpr int mantissaBits = 52;
+    static constexpr int minimumExponent = -1023;
+    static constexpr int infinitePower = 0x7FF;
+    static constexpr int minRoundToEven = -4;
+    static constexpr int maxRoundToEven = 23;
+    static constexpr int smallestPowerOfTen = -342; // por debajo, siempre 0
+    static constexpr int largestPowerOfTen = 308;   // por encima, siempre infinito
+    static constexpr int maxExactPowerOfTen = 22;   // 10^22 es exacto en double
+    static constexpr std::uint64_t maxExactMantissa = std::uint64_t{1} << 53;
+    static constexpr double exactPowers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template <>
+struct Binary<float> {
+    using Bits = std::uint32_t;
+    static constexpr int mantissaBits = 23;
+    static constexpr int minimumExponent = -127;
+    static constexpr int infinitePower = 0xFF;
+    static constexpr int minRoundToEven = -17;
+    static constexpr int maxRoundToEven = 10;
+    static constexpr int smallestPowerOfTen = -64;
+    static constexpr int largestPowerOfTen = 38;
+    static constexpr int maxExactPowerOfTen = 10;
+    static constexpr std::uint64_t maxExactMantissa = std::uint64_t{1} << 24;
+    static constexpr float exactPowers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+// ----------------------------
+// Tabla de potencias de 5
+// ----------------------------
+// Para cada q en [-342, 308], los 128 bits más altos de 5^q (normalizados con
+// el bit 127 a 1). Para q < 0 es el recíproco 2^b / 5^-q redondeado hacia
+// arriba, con la misma construcción que la tabla publicada con el algoritmo.
+// Se calcula una vez, la primera vez que se usa, con aritmética entera exacta.
+constexpr int smallestPowerOfFive = -342;
+constexpr int largestPowerOfFive = 308;
+constexpr int powerCount = largestPowerOfFive - smallestPowerOfFive + 1;
+
+struct PowerTable {
+    std::uint64_t values[2 * powerCount]; // alto, bajo
+};
+
+// Entero sin signo arbitrario, palabras de 32 bits de menor a mayor peso.
+using BigInt = std::vector<std::uint32_t>;
+
+long bitLength(const BigInt& big) {
+    for (std::size_t i = big.size(); i-- > 0;) {
+        if (big[i] != 0) return static_cast<long>(i * 32 + 32 - static_cast<std::size_t>(__builtin_clz(big[i])));
+    }
+    return 0;
+}
+
+void multiplySmall(BigInt& big, std::uint32_t factor) {
+    std::uint64_t carry{0};
+    for (std::uint32_t& word : big) {
+        const std::uint64_t product = std::uint64_t{word} * factor + carry;
+        word = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+    if (carry != 0) big.push_back(static_cast<std::uint32_t>(carry));
+}
+
+void divideSmall(BigInt& big, std::uint32_t divisor) {
+    std::uint64_t remainder{0};
+    for (std::size_t i = big.size(); i-- > 0;) {
+        const std::uint64_t current = (remainder << 32) | big[i];
+        big[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    while (!big.empty() && big.back() == 0) big.pop_back();
+}
+
+void addOne(BigInt& big) {
+    for (std::uint32_t& word : big) {
+        if (++word != 0) return;
+    }
+    big.push_back(1);
+}
+
+// Los 128 bits más altos de big (desplazando a la izquierda si tiene menos).
+void top128(const BigInt& big, std::uint64_t& high, std::uint64_t& low) {
+    const long start = bitLength(big) - 128;
+    auto bitAt = [&](long position) -> std::uint64_t {
+        if (position < 0) return 0;
+        return (big[static_cast<std::size_t>(position / 32)] >> (position % 32)) & 1u;
+    };
+    high = 0;
+    low = 0;
+    for (long i = 127; i >= 64; --i) high = (high << 1) | bitAt(start + i);
+    for (long i = 63; i >= 0; --i) low = (low << 1) | bitAt(start + i);
+}
+
+PowerTable buildPowerTable() {
+    PowerTable table{};
+    auto entry = [&](int q) { return &table.values[2 * (q - smallestPowerOfFive)]; };
+
+    // q >= 0: 5^q truncado.
+    BigInt power{1};
+    for (int q = 0; q <= largestPowerOfFive; ++q) {
+        std::uint64_t* out = entry(q);
+        top128(power, out[0], out[1]);
+        multiplySmall(power, 5);
+    }
+
+    // q < 0: floor(2^b / 5^n) + 1, con b suficiente para 128 bits significativos.
+    constexpr std::uint32_t fivePow13 = 1220703125; // 5^13, cabe en 32 bits
+    BigInt fivePowN{1};
+    for (int n = 1; n <= -smallestPowerOfFive; ++n) {
+        multiplySmall(fivePowN, 5);
+        const long z = bitLength(fivePowN); // 2^(z-1) < 5^n < 2^z
+        const long b = n <= 27 ? z + 127 : 2 * z + 128;
+
+        BigInt quotient(static_cast<std::size_t>(b / 32 + 1), 0);
+        quotient[static_cast<std::size_t>(b / 32)] = std::uint32_t{1} << (b % 32);
+        int remaining = n;
+        for (; remaining >= 13; remaining -= 13) divideSmall(quotient, fivePow13);
+        std::uint32_t lastDivisor{1};
+        for (int i = 0; i < remaining; ++i) lastDivisor *= 5;
+        divideSmall(quotient, lastDivisor);
+        addOne(quotient);
+
+        std::uint64_t* out = entry(-n);
+        top128(quotient, out[0], out[1]);
+    }
+    return table;
+}
+
+inline const PowerTable& powersOfFive() {
+    static const PowerTable table = buildPowerTable();
+    return table;
+}
+
+// ----------------------------
+// Eisel-Lemire
+// ----------------------------
+struct Product {
+    std::uint64_t high;
+    std::uint64_t low;
+};
+
+Product multiply(std::uint64_t a, std::uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return Product{static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#else
+    const std::uint64_t aLow = a & 0xFFFFFFFFu, aHigh = a >> 32;
+    const std::uint64_t bLow = b & 0xFFFFFFFFu, bHigh = b >> 32;
+    const std::uint64_t lowLow = aLow * bLow;
+    const std::uint64_t highLow = aHigh * bLow;
+    const std::uint64_t lowHigh = aLow * bHigh;
+    const std::uint64_t highHigh = aHigh * bHigh;
+    const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+    return Product{highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32),
+                   (middle << 32) | (lowLow & 0xFFFFFFFFu)};
+#endif
+}
+
+// Mantisa (sin el bit implícito) y exponente binario sesgado del resultado.
+struct Adjusted {
+    std::uint64_t mantissa;
+    int power2;
+};
+
+// power(q) ≈ floor(q * log2(10)) + 63, exacto para |q| <= 1233.
+int binaryPower(int q) {
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+// w × 10^q redondeado al tipo T, con w != 0 y q en el rango de la tabla.
+// Inline en parseImpl: es el camino de casi todos los números con 17 dígitos.
+template <typename T>
+__attribute__((always_inline)) inline Adjusted eiselLemire(std::uint64_t w, int q, const PowerTable& table) {
+    using B = Binary<T>;
+    if (q < B::smallestPowerOfTen) return Adjusted{0, 0};
+    if (q > B::largestPowerOfTen) return Adjusted{0, B::infinitePower};
+
+    const int leadingZeros = __builtin_clzll(w);
+    w <<= leadingZeros;
+
+    // Producto de 64×128 bits; la segunda mitad solo hace falta si los bits
+    // que deciden el redondeo son todos 1 (el acarreo podría cambiarlos).
+    const std::uint64_t* power = &table.values[2 * (q - smallestPowerOfFive)];
+    Product product = multiply(w, power[0]);
+    constexpr std::uint64_t precisionMask = ~std::uint64_t{0} >> (B::mantissaBits + 3);
+    if ((product.high & precisionMask) == precisionMask) {
+        const Product second = multiply(w, power[1]);
+        product.low += second.high;
+        if (second.high > product.low) ++product.high;
+    }
+
+    const int upperBit = static_cast<int>(product.high >> 63);
+    const int shift = upperBit + 64 - B::mantissaBits - 3;
+    Adjusted answer{product.high >> shift, binaryPower(q) + upperBit - leadingZeros - B::minimumExponent};
+
+    if (answer.power2 <= 0) { // subnormal
+        if (-answer.power2 + 1 >= 64) return Adjusted{0, 0};
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+        answer.power2 = answer.mantissa < (std::uint64_t{1} << B::mantissaBits) ? 0 : 1;
+        return answer;
+    }
+
+    // Exactamente a medio camino entre dos valores: empate al par. Solo
+    // puede pasar con exponentes decimales pequeños.
+    if (product.low <= 1 && q >= B::minRoundToEven && q <= B::maxRoundToEven && (answer.mantissa & 3) == 1 &&
+        (answer.mantissa << shift) == product.high) {
+        answer.mantissa &= ~std::uint64_t{1};
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (std::uint64_t{2} << B::mantissaBits)) {
+        answer.mantissa = std::uint64_t{1} << B::mantissaBits;
+        ++answer.power2;
+    }
+    answer.mantissa &= ~(std::uint64_t{1} << B::mantissaBits);
+    if (answer.power2 >= B::infinitePower) return Adjusted{0, B::infinitePower};
+    return answer;
+}
+
+template <typename T>
+T fromAdjusted(Adjusted adjusted, bool negative) {
+    using Bits = typename Binary<T>::Bits;
+    Bits bits = static_cast<Bits>(adjusted.mantissa) |
+                (static_cast<Bits>(adjusted.power2) << Binary<T>::mantissaBits);
+    if (negative) bits |= Bits{1} << (sizeof(Bits) * 8 - 1);
+    T value{};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// ----------------------------
+// Lectura del texto
+// ----------------------------
+bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10u;
+}
+
+bool isHexDigit(char c) {
+    return isDigit(c) || static_cast<unsigned char>((c | 0x20) - 'a') < 6u;
+}
+
+bool isBinaryDigit(char c) {
+    return c == '0' || c == '1';
+}
+
+// ----------------------------
+// SWAR: 8 dígitos en un uint64_t
+// ----------------------------
+// Con memcpy el primer carácter queda en el byte bajo (little-endian).
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define DECIMAL_PARSER_SWAR 1
+
+std::uint64_t load8(const char* text) {
+    std::uint64_t chunk{};
+    std::memcpy(&chunk, text, sizeof(chunk));
+    return chunk;
+}
+
+// Bit alto en cada byte que no es un dígito. Con x = chunk ^ '0' los dígitos
+// quedan en 0..9 y x + 0x76 pone el bit alto en cuanto x >= 10; los acarreos
+// solo afectan a bytes posteriores al primer no dígito.
+std::uint64_t nonDigitMask(std::uint64_t chunk) {
+    const std::uint64_t digits = chunk ^ 0x3030303030303030ull;
+    return ((digits + 0x7676767676767676ull) | digits) & 0x8080808080808080ull;
+}
+
+constexpr std::uint64_t powersOfTen[9] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+std::uint64_t parse8(std::uint64_t chunk) {
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+    chunk = (chunk & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+    return (chunk & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32;
+}
+#endif
+
+// Un separador ' solo vale entre dos dígitos de la misma base.
+template <typename IsDigit>
+bool separatorAt(const char* p, const char* first, const char* last, IsDigit isDigitOfBase) {
+    return *p == '\'' && p > first && isDigitOfBase(p[-1]) && p + 1 < last && isDigitOfBase(p[1]);
+}
+
+// Copia text sin separadores y lo convierte con std::from_chars. Es el camino
+// exacto: hexadecimal, binario (ya pasado a hexadecimal) y los decimales que
+// Eisel-Lemire no puede decidir. from_chars no dice hacia dónde se salió del
+// rango, así que el llamador indica si sería por abajo (tooSmall) o por arriba.
+template <typename T>
+std::from_chars_result fromCharsClean(std::string_view text, bool negative, std::chars_format format, bool tooSmall,
+                                      T& value, const char* resultEnd) {
+    char small[128];
+    std::string large{};
+    char* out = small;
+    if (text.size() + 1 > sizeof(small)) {
+        large.resize(text.size() + 1);
+        out = large.data();
+    }
+    char* const begin = out;
+    if (negative) *out++ = '-';
+    for (const char c : text) {
+        if (c != '\'') *out++ = c;
+    }
+
+    T parsed{};
+    const auto result = std::from_chars(begin, out, parsed, format);
+    if (result.ec == std::errc::result_out_of_range) {
+        parsed = tooSmall ? T{0} : std::numeric_limits<T>::infinity();
+        value = negative ? -parsed : parsed;
+        return std::from_chars_result{resultEnd, result.ec};
+    }
+    if (result.ec != std::errc{}) return std::from_chars_result{resultEnd, result.ec};
+    value = parsed;
+    return std::from_chars_result{resultEnd, std::errc{}};
+}
+
+template <typename T>
+std::from_chars_result parseHexOrBinary(const char* first, const char* start, const char* last, bool negative,
+                                        bool binary, T& value) {
+    // start apunta justo después de "0x" / "0b".
+    const char* p = start;
+    if (binary) {
+        while (p < last && (isBinaryDigit(*p) || separatorAt(p, start, last, isBinaryDigit))) ++p;
+        // Binario a hexadecimal: 4 bits por dígito, rellenando por la izquierda.
+        std::string hex{};
+        unsigned nibble{0};
+        std::size_t bits{0};
+        for (const char* q = start; q < p; ++q) {
+            if (*q != '\'') ++bits;
+        }
+        std::size_t padding = (4 - bits % 4) % 4;
+        for (const char* q = start; q < p; ++q) {
+            if (*q == '\'') continue;
+            nibble = (nibble << 1) | static_cast<unsigned>(*q - '0');
+            if (++padding == 4) {
+                hex.push_back("0123456789abcdef"[nibble]);
+                nibble = 0;
+                padding = 0;
+            }
+        }
+        return fromCharsClean(std::string_view{hex}, negative, std::chars_format::hex, false, value, p);
+    }
+
+    while (p < last && (isHexDigit(*p) || separatorAt(p, start, last, isHexDigit))) ++p;
+    const bool hasIntegerDigits = p > start;
+    bool hasFractionDigits{false};
+    if (p < last && *p == '.') {
+        const char* fraction = ++p;
+        while (p < last && (isHexDigit(*p) || separatorAt(p, fraction, last, isHexDigit))) ++p;
+        hasFractionDigits = p > fraction;
+    }
+    if (!hasIntegerDigits && !hasFractionDigits) return std::from_chars_result{first, std::errc::invalid_argument};
+    bool negativeExponent{false};
+    if (p < last && (*p == 'p' || *p == 'P')) {
+        const char* exponent = p + 1;
+        if (exponent < last && (*exponent == '+' || *exponent == '-')) negativeExponent = *exponent++ == '-';
+        const char* digits = exponent;
+        while (exponent < last && (isDigit(*exponent) || separatorAt(exponent, digits, last, isDigit))) ++exponent;
+        if (exponent > digits) p = exponent;
+    }
+    return fromCharsClean(std::string_view{start, static_cast<std::size_t>(p - start)}, negative,
+                          std::chars_format::hex, negativeExponent, value, p);
+}
+
+// Acumula en w los dígitos decimales desde p (con separadores) y los cuenta
+// en count. Con más de 19 dígitos w desborda: el llamador lo comprueba.
+// Siempre inline: así w y count se quedan en registros.
+__attribute__((always_inline)) inline
+const char* scanDigits(const char* p, const char* last, std::uint64_t& w, int& count) {
+    const char* const runStart = p;
+    while (true) {
+#ifdef DECIMAL_PARSER_SWAR
+        // De 8 en 8. El último trozo (de 0 a 7 dígitos) tampoco se lee byte a
+        // byte: se suben sus n dígitos a la parte alta con '0' delante y
+        // parse8 da su valor, sin un salto por dígito. El bucle de abajo solo
+        // queda para los últimos 7 bytes del texto.
+        while (last - p >= 8) {
+            const std::uint64_t chunk = load8(p);
+            const std::uint64_t nonDigits = nonDigitMask(chunk);
+            if (nonDigits == 0) {
+                w = w * 100000000u + parse8(chunk);
+                count += 8;
+                p += 8;
+                continue;
+            }
+            const unsigned n = static_cast<unsigned>(__builtin_ctzll(nonDigits)) / 8;
+            if (n != 0) {
+                const std::uint64_t tail = chunk << (64 - 8 * n) | 0x3030303030303030ull >> (8 * n);
+                w = w * powersOfTen[n] + parse8(tail);
+                count += static_cast<int>(n);
+                p += n;
+            }
+            break;
+        }
+#endif
+        while (p < last && isDigit(*p)) {
+            w = w * 10 + static_cast<std::uint64_t>(*p - '0');
+            ++count;
+            ++p;
+        }
+        if (p < last && separatorAt(p, runStart, last, isDigit)) {
+            ++p;
+            continue;
+        }
+        return p;
+    }
+}
+
+// Camino lento para más de 19 dígitos: w se queda con los 19 primeros
+// significativos (sin contar ceros a la izquierda), el resto solo mueve el
+// exponente. Devuelve true si algún dígito descartado no era 0.
+bool countSignificant(const char* p, const char* last, std::uint64_t& w, long long& exponent) {
+    w = 0;
+    exponent = 0;
+    int significant{0};
+    bool truncated{false};
+    bool fraction{false};
+    for (; p < last; ++p) {
+        const char c = *p;
+        if (c == '.') {
+            fraction = true;
+        } else if (isDigit(c)) {
+            if (significant < 19) {
+                w = w * 10 + static_cast<std::uint64_t>(c - '0');
+                if (w != 0) ++significant;
+                if (fraction) --exponent;
+            } else {
+                if (c != '0') truncated = true;
+                if (!fraction) ++exponent;
+            }
+        }
+    }
+    return truncated;
+}
+
+template <typename T>
+std::from_chars_result parseImpl(const char* first, const char* last, T& value) {
+    using B = Binary<T>;
+    const char* p = first;
+    bool negative{false};
+    if (p < last && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == last) return std::from_chars_result{first, std::errc::invalid_argument};
+
+    // inf, infinity, nan: se los dejamos a from_chars.
+    if (!isDigit(*p) && *p != '.') {
+        if (*p == '-' || *p == '+') return std::from_chars_result{first, std::errc::invalid_argument};
+        T parsed{};
+        const auto result = std::from_chars(p, last, parsed);
+        if (result.ec != std::errc{}) return std::from_chars_result{first, std::errc::invalid_argument};
+        value = negative ? -parsed : parsed;
+        return result;
+    }
+
+    // Prefijos 0x y 0b. "0x" sin dígitos detrás se lee como el número 0.
+    if (*p == '0' && last - p > 2) {
+        const char prefix = static_cast<char>(p[1] | 0x20);
+        if (prefix == 'x' && (isHexDigit(p[2]) || (p[2] == '.' && last - p > 3 && isHexDigit(p[3])))) {
+            return parseHexOrBinary(first, p + 2, last, negative, false, value);
+        }
+        if (prefix == 'b' && isBinaryDigit(p[2])) {
+            return parseHexOrBinary(first, p + 2, last, negative, true, value);
+        }
+    }
+
+    // Decimal. Camino habitual: 19 dígitos o menos en total, que caben en w
+    // sin desbordar. Si hay más, se vuelve a recorrer con countSignificant.
+    const char* const digitsStart = p;
+    std::uint64_t w{0};
+    int integerDigits{0};
+    int fractionDigits{0};
+    p = scanDigits(p, last, w, integerDigits);
+    if (p < last && *p == '.') p = scanDigits(p + 1, last, w, fractionDigits);
+    if (integerDigits + fractionDigits == 0) return std::from_chars_result{first, std::errc::invalid_argument};
+
+    long long exponent = -fractionDigits;
+    bool truncated{false};
+    if (integerDigits + fractionDigits > 19) truncated = countSignificant(digitsStart, p, w, exponent);
+
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool exponentNegative{false};
+        if (q < last && (*q == '-' || *q == '+')) exponentNegative = *q++ == '-';
+        const char* exponentDigits = q;
+        long long written{0};
+        while (q < last) {
+            if (isDigit(*q)) {
+                if (written < 100000) written = written * 10 + (*q - '0');
+            } else if (!separatorAt(q, exponentDigits, last, isDigit)) {
+                break;
+            }
+            ++q;
+        }
+        if (q > exponentDigits) { // una 'e' sin dígitos no forma parte del número
+            exponent += exponentNegative ? -written : written;
+            p = q;
+        }
+    }
+
+    if (w == 0) { // 0, 0.000, 0e10...
+        value = negative ? -T{0} : T{0};
+        return std::from_chars_result{p, std::errc{}};
+    }
+
+    // Clinger: mantisa y potencia de 10 exactas en T, una sola operación redondeada.
+    if (!truncated && exponent >= -B::maxExactPowerOfTen && exponent <= B::maxExactPowerOfTen &&
+        w <= B::maxExactMantissa) {
+        T result = static_cast<T>(w);
+        if (exponent < 0) {
+            result /= B::exactPowers[-exponent];
+        } else {
+            result *= B::exactPowers[exponent];
+        }
+        value = negative ? -result : result;
+        return std::from_chars_result{p, std::errc{}};
+    }
+
+    const int q = exponent < -100000 ? -100000 : exponent > 100000 ? 100000 : static_cast<int>(exponent);
+    const PowerTable& table = powersOfFive();
+    const Adjusted adjusted = eiselLemire<T>(w, q, table);
+    if (truncated) {
+        // El valor real está entre w y w + 1 (× 10^q): si los dos redondean
+        // igual, los dígitos descartados no importan.
+        const Adjusted upper = eiselLemire<T>(w + 1, q, table);
+        if (upper.mantissa != adjusted.mantissa || upper.power2 != adjusted.power2) {
+            return fromCharsClean(std::string_view{digitsStart, static_cast<std::size_t>(p - digitsStart)}, negative,
+                                  std::chars_format::general, q < 0, value, p);
+        }
+    }
+
+    value = fromAdjusted<T>(adjusted, negative);
+    const bool overflow = adjusted.power2 == B::infinitePower;
+    const bool underflow = adjusted.power2 == 0 && adjusted.mantissa == 0;
+    return std::from_chars_result{p, overflow || underflow ? std::errc::result_out_of_range : std::errc{}};
+}
+
+// ----------------------------
+// Lectura en bloque
+// ----------------------------
+// Una sola pasada: cada campo se lee directamente desde el texto y el número
+// termina donde termina el campo (tras blancos opcionales, un separador, un
+// salto de línea o el final). Solo si el separador puede formar parte de un
+// número (un dígito, '.', 'e'...) se busca antes el final del campo y se lee
+// hasta ahí, para no leer "1.5" entero con separator == '.'.
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool canBeInNumber(char c) {
+    const auto u = static_cast<unsigned char>(c);
+    return isDigit(c) || static_cast<unsigned char>((u | 0x20) - 'a') < 26u || c == '.' || c == '\'' || c == '+' ||
+           c == '-';
+}
+
+// column == npos: todas las columnas.
+template <typename T>
+BulkResult parseBulk(std::string_view text, char separator, std::size_t column, std::vector<T>& values) {
+    BulkResult result{};
+    const char* const begin = text.data();
+    const char* const last = begin + text.size();
+    const bool boundFields = canBeInNumber(separator);
+
+    // Los blancos alrededor de un campo se ignoran, salvo que sean el separador.
+    auto isPadding = [&](const char* p) { return p < last && isBlank(*p) && *p != separator; };
+    auto isFieldEnd = [&](const char* p) { return p == last || *p == separator || *p == '\n'; };
+    auto fieldEnd = [&](const char* p) {
+        while (!isFieldEnd(p)) ++p;
+        return p;
+    };
+    auto fail = [&](const char* at) {
+        values.push_back(std::numeric_limits<T>::quiet_NaN());
+        if (result.errors++ == 0) result.firstErrorOffset = static_cast<std::size_t>(at - begin);
+    };
+
+    const char* p = begin;
+    while (p < last) {
+        const char* const lineStart = p;
+        // Una línea vacía o solo con blancos no produce campos.
+        const char* q = p;
+        while (q < last && isBlank(*q)) ++q;
+        if (q == last) break;
+        if (*q == '\n') {
+            p = q + 1;
+            continue;
+        }
+
+        std::size_t index{0};
+        bool found{false};
+        while (true) {
+            while (isPadding(p)) ++p;
+            if (column == std::string_view::npos || index == column) {
+                const char* const field = p;
+                T value{};
+                bool ok{false};
+                if (!isFieldEnd(p)) {
+                    const auto parsed = parseImpl(p, boundFields ? fieldEnd(p) : last, value);
+                    const char* end = parsed.ptr;
+                    while (isPadding(end)) ++end;
+                    ok = parsed.ec != std::errc::invalid_argument && isFieldEnd(end);
+                    if (ok) p = end;
+                }
+                if (ok) {
+                    values.push_back(value);
+                    ++result.values;
+                } else {
+                    fail(field);
+                    p = fieldEnd(field);
+                }
+                found = true;
+                if (column != std::string_view::npos) break;
+            } else {
+                p = fieldEnd(p);
+            }
+            if (p == last || *p == '\n') break;
+            ++p;
+            ++index;
+        }
+        if (!found) fail(lineStart); // línea con menos columnas de las pedidas
+
+        const void* newline = std::memchr(p, '\n', static_cast<std::size_t>(last - p));
+        p = newline != nullptr ? static_cast<const char*>(newline) + 1 : last;
+    }
+    return result;
+}
+
+} // namespace
+
+std::from_chars_result parse(const char* first, const char* last, double& value) {
+    return parseImpl(first, last, value);
+}
+
+std::from_chars_result parse(const char* first, const char* last, float& value) {
+    return parseImpl(first, last, value);
+}
+
+BulkResult parseFields(std::string_view text, char separator, std::vector<double>& values) {
+    return parseBulk(text, separator, std::string_view::npos, values);
+}
+
+BulkResult parseFields(std::string_view text, char separator, std::vector<float>& values) {
+    return parseBulk(text, separator, std::string_view::npos, values);
+}
+
+BulkResult parseColumn(std::string_view text, char separator, std::size_t column, std::vector<double>& values) {
+    return parseBulk(text, separator, column, values);
+}
+
+BulkResult parseColumn(std::string_view text, char separator, std::size_t column, std::vector<float>& values) {
+    return parseBulk(text, separator, column, values);
+}
+
+} // namespace decimal_parser
@@ -0,0 +1,68 @@
+#ifndef DECIMAL_PARSER_H
+#define DECIMAL_PARSER_H
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace decimal_parser
+ * @brief Texto a double/float correctamente redondeado, sin locale.
+ *
+ * Camino rápido: el algoritmo de Eisel-Lemire (una multiplicación de 64×128
+ * bits por una potencia de 5 precalculada) y, antes aún, el caso exacto de
+ * Clinger para mantisas y exponentes pequeños. Si el texto tiene más de 19
+ * dígitos significativos y Eisel-Lemire no puede decidir el redondeo, se usa
+ * std::from_chars, que es exacto. El resultado es siempre el double (o float)
+ * más cercano, con empate al par, como exige IEEE 754.
+ *
+ * Formatos aceptados (los literales de 3-Numerals.cpp):
+ * - Decimal: [+-]123, 1.5, .5, 5., 1e-3, 6.02E23
+ * - Separadores de dígitos entre dos dígitos: 2'132'673'462, 1'000.000'1
+ * - Hexadecimal: 0x1A, 0xFF, 0x1.8p3 (como los literales hexadecimales de C++17)
+ * - Binario: 0b1010, 0b1100'0101 (solo enteros, como en C++)
+ * - inf, infinity, nan (sin distinguir mayúsculas)
+ *
+ * Un 0 inicial NO indica octal: "012" es 12, como en los literales de coma
+ * flotante de C++.
+ */
+namespace decimal_parser {
+
+/**
+ * @brief Convierte el número que empieza en first.
+ * @return ptr apunta al primer carácter que no forma parte del número.
+ *         ec es std::errc::invalid_argument si no hay número (value no cambia)
+ *         o std::errc::result_out_of_range si el valor no cabe en el tipo; en
+ *         ese caso, como strtod, value recibe ±infinito o ±0.
+ */
+std::from_chars_result parse(const char* first, const char* last, double& value);
+std::from_chars_result parse(const char* first, const char* last, float& value);
+
+/// Resultado de las funciones de lectura en bloque.
+struct BulkResult {
+    std::size_t values{0};                 ///< Números añadidos al vector.
+    std::size_t errors{0};                 ///< Campos que no eran un número (se añade NaN en su lugar).
+    std::size_t firstErrorOffset{std::string_view::npos}; ///< Posición en el texto del primer campo erróneo.
+};
+
+/**
+ * @brief Lee todos los campos de un texto separado por separator y saltos de línea.
+ *
+ * Los espacios y tabuladores alrededor de cada campo se ignoran, y también los
+ * '\r' de los ficheros de Windows. Las líneas vacías no producen campos.
+ */
+BulkResult parseFields(std::string_view text, char separator, std::vector<double>& values);
+BulkResult parseFields(std::string_view text, char separator, std::vector<float>& values);
+
+/**
+ * @brief Lee solo la columna column (empezando en 0) de cada línea.
+ *
+ * Las líneas con menos columnas cuentan como error.
+ */
+BulkResult parseColumn(std::string_view text, char separator, std::size_t column, std::vector<double>& values);
+BulkResult parseColumn(std::string_view text, char separator, std::size_t column, std::vector<float>& values);
+
+} // namespace decimal_parser
+
+#endif // DECIMAL_PARSER_H
@@ -0,0 +1,52 @@
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <vector>
+#include "decimal_parser.h"
+
+// Lee los literales de 3-Numerals.cpp y los ejemplos de 7-Floats.cpp como
+// texto, y después una pequeña tabla separada por comas.
+int main() {
+    std::cout << std::setprecision(17);
+
+    const std::string_view inputs[] = {
+        "12", "012", "0xF", "0x1A", "0b1010", "0b1100'0101", "2'132'673'462", "0x1.8p3",
+        "0.1", "9876543.21", "6.02e23", "-0", "inf", "1e400", "1e-400", "12abc", "abc",
+    };
+
+    for (const std::string_view text : inputs) {
+        double value{};
+        const auto result = decimal_parser::parse(text.data(), text.data() + text.size(), value);
+        std::cout << std::left << std::setw(16) << text << std::right;
+        if (result.ec == std::errc::invalid_argument) {
+            std::cout << "no es un número\n";
+            continue;
+        }
+        std::cout << value;
+        if (result.ec == std::errc::result_out_of_range) std::cout << "   (fuera de rango)";
+        if (result.ptr != text.data() + text.size()) {
+            std::cout << "   (sobra: \"" << std::string_view{result.ptr, static_cast<std::size_t>(text.data() + text.size() - result.ptr)} << "\")";
+        }
+        std::cout << '\n';
+    }
+
+    // 0.1 sumado diez veces no da 1, pero "0.1" se lee siempre como el double más cercano.
+    double tenth{};
+    const std::string_view text{"0.1"};
+    decimal_parser::parse(text.data(), text.data() + text.size(), tenth);
+    std::cout << "\n0.1 leído: " << tenth << (tenth == 0.1 ? "  (igual que el literal 0.1)\n" : "\n");
+
+    // Lectura en bloque: columna 1 de una tabla con cabecera errónea.
+    const std::string_view table =
+        "nombre,peso,altura\n"
+        "Alex,72.5,1.80\n"
+        "John,81,1.75\r\n"
+        "Peach, 55.25 ,1.62\n";
+    std::vector<double> weights{};
+    const decimal_parser::BulkResult result = decimal_parser::parseColumn(table, ',', 1, weights);
+    std::cout << "\nColumna peso: " << result.values << " valores, " << result.errors
+              << " errores (primero en la posición " << result.firstErrorOffset << ")\n";
+    for (const double weight : weights) std::cout << "  " << weight << '\n';
+
+    return 0;
+}
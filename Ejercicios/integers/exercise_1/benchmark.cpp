@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "column_file.h"
+
+// ----------------------------
+// Benchmark: cargar N enteros de disco
+// ----------------------------
+// Una columna de N int32_t (2^24 por defecto) guardada como texto (un número
+// por línea) y como fichero de columnas. Se mide, en milisegundos (mejor de
+// 3), desde abrir el fichero hasta tener la suma:
+//
+// - texto con std::ifstream >> x;
+// - texto leído entero a memoria y convertido con std::from_chars;
+// - columnas: solo abrir (mmap y validar cabeceras), abrir y sumar, y abrir,
+//   comprobar checksums y sumar;
+// - columnas copiadas a un std::vector con fread, para comparar con mmap.
+//
+// Los ficheros se acaban de escribir, así que están en la caché de páginas
+// del sistema: se mide convertir, no el disco. Con el fichero fuera de
+// caché, abrir con mmap sigue costando lo mismo y lo demás depende del disco.
+
+namespace {
+
+volatile long long sink{0};
+
+template <typename F>
+double bestSeconds(F&& body) {
+    double best{1e30};
+    for (int run = 0; run < 3; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void report(const std::string& name, std::size_t count, double seconds, bool same) {
+    std::cout << "  " << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << seconds * 1e3 << " ms" << std::setprecision(0) << std::setw(10)
+              << count / seconds / 1e6 << " M/s" << (same ? "" : "   ¡SUMA DISTINTA!") << '\n';
+}
+
+long long sum(std::span<const std::int32_t> values) {
+    return std::accumulate(values.begin(), values.end(), 0LL);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = std::size_t{1} << 24;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    std::vector<std::int32_t> values(count);
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<std::int32_t> distribution{-1'000'000'000, 1'000'000'000};
+    for (std::int32_t& value : values) value = distribution(rng);
+    const long long expected = sum(values);
+
+    const std::string textPath = "column_file_bench.txt";
+    const std::string columnPath = "column_file_bench.cols";
+
+    const double textWriteSeconds = bestSeconds([&] {
+        std::ofstream out{textPath, std::ios::binary};
+        char buffer[16];
+        for (const std::int32_t value : values) {
+            char* end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+            *end++ = '\n';
+            out.write(buffer, end - buffer);
+        }
+    });
+    const double columnWriteSeconds = bestSeconds([&] {
+        column_file::Writer writer{columnPath};
+        writer.addColumn("valor", values);
+        writer.finish();
+    });
+
+    std::cout << count << " int32_t\n";
+    std::cout << "Escribir:\n";
+    report("texto (to_chars)", count, textWriteSeconds, true);
+    report("columnas (Writer)", count, columnWriteSeconds, true);
+
+    std::cout << "Cargar y sumar:\n";
+    long long total{0};
+    double seconds = bestSeconds([&] {
+        std::ifstream in{textPath};
+        long long partial{0};
+        std::int32_t value{};
+        while (in >> value) partial += value;
+        total = partial;
+        sink = total;
+    });
+    report("texto, ifstream >> x", count, seconds, total == expected);
+
+    seconds = bestSeconds([&] {
+        std::ifstream in{textPath, std::ios::binary | std::ios::ate};
+        std::string text(static_cast<std::size_t>(in.tellg()), '\0');
+        in.seekg(0);
+        in.read(text.data(), static_cast<std::streamsize>(text.size()));
+        long long partial{0};
+        const char* position = text.data();
+        const char* const end = text.data() + text.size();
+        std::int32_t value{};
+        while (position < end) {
+            position = std::from_chars(position, end, value).ptr + 1; // salta el '\n'
+            partial += value;
+        }
+        total = partial;
+        sink = total;
+    });
+    report("texto, from_chars", count, seconds, total == expected);
+
+    seconds = bestSeconds([&] {
+        const column_file::MappedFile file{columnPath};
+        sink = static_cast<long long>(file.column<std::int32_t>("valor").size());
+    });
+    report("columnas, solo abrir", count, seconds, true);
+
+    seconds = bestSeconds([&] {
+        const column_file::MappedFile file{columnPath};
+        total = sum(file.column<std::int32_t>("valor"));
+        sink = total;
+    });
+    report("columnas, abrir y sumar", count, seconds, total == expected);
+
+    seconds = bestSeconds([&] {
+        const column_file::MappedFile file{columnPath};
+        file.verifyChecksums();
+        total = sum(file.column<std::int32_t>("valor"));
+        sink = total;
+    });
+    report("columnas, checksums y sumar", count, seconds, total == expected);
+
+    seconds = bestSeconds([&] {
+        const column_file::MappedFile file{columnPath};
+        const column_file::ColumnHeader& column = file.header(file.find("valor"));
+        std::vector<std::int32_t> copy(column.count);
+        std::FILE* in = std::fopen(columnPath.c_str(), "rb");
+        if (in == nullptr || std::fseek(in, static_cast<long>(column.offset), SEEK_SET) != 0 ||
+            std::fread(copy.data(), sizeof(std::int32_t), copy.size(), in) != copy.size()) {
+            std::cerr << "No se pudo leer " << columnPath << '\n';
+            std::exit(1);
+        }
+        std::fclose(in);
+        total = sum(copy);
+        sink = total;
+    });
+    report("columnas, fread a vector y sumar", count, seconds, total == expected);
+
+    std::remove(textPath.c_str());
+    std::remove(columnPath.c_str());
+    return 0;
+}
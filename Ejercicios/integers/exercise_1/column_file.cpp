@@ -0,0 +1,345 @@
+#include "column_file.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace column_file {
+
+namespace {
+
+constexpr std::size_t writeBufferSize = std::size_t{1} << 20;
+
+std::uint64_t alignUp(std::uint64_t value) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::runtime_error error(const std::string& path, const std::string& message) {
+    return std::runtime_error{"column_file: " + path + ": " + message};
+}
+
+constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87u;
+constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Fu;
+
+std::uint64_t mix(std::uint64_t lane, std::uint64_t word) {
+    return std::rotl(lane + word * prime2, 31) * prime1;
+}
+
+} // namespace
+
+std::size_t widthOf(ElementType type) {
+    switch (type) {
+    case ElementType::Int8:
+    case ElementType::UInt8: return 1;
+    case ElementType::Int16:
+    case ElementType::UInt16: return 2;
+    case ElementType::Int32:
+    case ElementType::UInt32: return 4;
+    case ElementType::Int64:
+    case ElementType::UInt64: return 8;
+    }
+    return 0;
+}
+
+const char* typeName(ElementType type) {
+    switch (type) {
+    case ElementType::Int8: return "int8_t";
+    case ElementType::Int16: return "int16_t";
+    case ElementType::Int32: return "int32_t";
+    case ElementType::Int64: return "int64_t";
+    case ElementType::UInt8: return "uint8_t";
+    case ElementType::UInt16: return "uint16_t";
+    case ElementType::UInt32: return "uint32_t";
+    case ElementType::UInt64: return "uint64_t";
+    }
+    return "desconocido";
+}
+
+Endianness hostEndianness() {
+    return std::endian::native == std::endian::little ? Endianness::Little : Endianness::Big;
+}
+
+// ----------------------------
+// Checksum
+// ----------------------------
+void Checksum::block(const unsigned char* bytes) {
+    for (int lane = 0; lane < 4; ++lane) {
+        std::uint64_t word{};
+        std::memcpy(&word, bytes + lane * 8, sizeof(word));
+        lanes_[lane] = mix(lanes_[lane], word);
+    }
+}
+
+void Checksum::update(const void* data, std::size_t size) {
+    if (size == 0) return; // data puede ser nullptr (span vacío)
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    total_ += size;
+    if (pendingSize_ != 0) {
+        const std::size_t take = std::min(size, sizeof(pending_) - pendingSize_);
+        std::memcpy(pending_ + pendingSize_, bytes, take);
+        pendingSize_ += take;
+        bytes += take;
+        size -= take;
+        if (pendingSize_ < sizeof(pending_)) return;
+        block(pending_);
+        pendingSize_ = 0;
+    }
+    for (; size >= sizeof(pending_); bytes += sizeof(pending_), size -= sizeof(pending_)) block(bytes);
+    std::memcpy(pending_, bytes, size);
+    pendingSize_ = size;
+}
+
+// Los bytes sueltos del final se completan con ceros; la longitud total
+// entra en el resultado, así que "x" y "x\0" no coinciden.
+std::uint64_t Checksum::value() const {
+    std::uint64_t lanes[4] = {lanes_[0], lanes_[1], lanes_[2], lanes_[3]};
+    if (pendingSize_ != 0) {
+        unsigned char last[32]{};
+        std::memcpy(last, pending_, pendingSize_);
+        for (int lane = 0; lane < 4; ++lane) {
+            std::uint64_t word{};
+            std::memcpy(&word, last + lane * 8, sizeof(word));
+            lanes[lane] = mix(lanes[lane], word);
+        }
+    }
+    std::uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) +
+                         std::rotl(lanes[3], 18) + total_;
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+std::uint64_t checksum(const void* data, std::size_t size) {
+    Checksum sum;
+    sum.update(data, size);
+    return sum.value();
+}
+
+// ----------------------------
+// Writer
+// ----------------------------
+Writer::Writer(const std::string& path) : path_(path), buffer_(writeBufferSize) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (file_ == nullptr) throw error(path_, "no se puede crear");
+    std::setvbuf(file_, buffer_.data(), _IOFBF, buffer_.size());
+    // Cabecera provisional: se reescribe en finish() con el directorio.
+    const FileHeader placeholder{};
+    write(&placeholder, sizeof(placeholder));
+}
+
+Writer::~Writer() {
+    if (file_ == nullptr) return;
+    try {
+        finish();
+    } catch (...) {
+        // Un destructor no debe lanzar: el fichero queda sin directorio.
+        if (file_ != nullptr) std::fclose(file_);
+    }
+}
+
+void Writer::write(const void* data, std::size_t size) {
+    if (size == 0) return;
+    if (std::fwrite(data, 1, size, file_) != size) {
+        failed_ = true;
+        throw error(path_, "error al escribir");
+    }
+    position_ += size;
+}
+
+void Writer::padTo(std::uint64_t offset) {
+    static constexpr char zeros[alignment]{};
+    write(zeros, static_cast<std::size_t>(offset - position_));
+}
+
+// Tras un fallo de E/S el fichero queda a medias (y position_ puede no
+// coincidir con lo escrito): cualquier llamada posterior lanza.
+void Writer::checkWritable() const {
+    if (failed_) throw error(path_, "una escritura anterior falló, el fichero está incompleto");
+    if (file_ == nullptr) throw error(path_, "el fichero ya está terminado");
+}
+
+void Writer::beginColumn(std::string_view name, ElementType type) {
+    checkWritable();
+    if (name.empty() || name.size() > maxNameLength) {
+        throw error(path_, "nombre de columna vacío o de más de " + std::to_string(maxNameLength) + " caracteres");
+    }
+    for (const ColumnHeader& column : columns_) {
+        if (name == column.name) throw error(path_, "columna repetida: " + std::string{name});
+    }
+    endColumn();
+
+    ColumnHeader column{};
+    std::memcpy(column.name, name.data(), name.size());
+    column.type = type;
+    column.width = static_cast<std::uint8_t>(widthOf(type));
+    column.endianness = hostEndianness();
+    column.offset = alignUp(position_);
+    padTo(column.offset);
+    columns_.push_back(column);
+    checksum_ = Checksum{};
+    open_ = true;
+}
+
+void Writer::appendBytes(ElementType type, const void* data, std::size_t size) {
+    checkWritable();
+    if (!open_) throw error(path_, "append sin beginColumn");
+    ColumnHeader& column = columns_.back();
+    if (type != column.type) {
+        throw error(path_, std::string{"la columna "} + column.name + " es de tipo " + typeName(column.type));
+    }
+    write(data, size);
+    checksum_.update(data, size);
+    column.count += size / column.width;
+}
+
+void Writer::endColumn() {
+    if (!open_) return;
+    columns_.back().checksum = checksum_.value();
+    open_ = false;
+}
+
+void Writer::finish() {
+    if (file_ == nullptr && !failed_) return; // ya terminado
+    checkWritable();
+    endColumn();
+
+    FileHeader header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = formatVersion;
+    header.columnCount = static_cast<std::uint32_t>(columns_.size());
+    header.directoryOffset = alignUp(position_);
+    padTo(header.directoryOffset);
+    write(columns_.data(), columns_.size() * sizeof(ColumnHeader));
+    header.fileSize = position_;
+
+    std::FILE* file = file_;
+    file_ = nullptr;
+    const bool ok = std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (std::fclose(file) != 0 || !ok) {
+        failed_ = true;
+        throw error(path_, "error al escribir la cabecera");
+    }
+}
+
+// ----------------------------
+// MappedFile
+// ----------------------------
+MappedFile::MappedFile(const std::string& path) : path_(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw error(path_, "no se puede abrir");
+    struct stat status{};
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw error(path_, "no se puede leer el tamaño");
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ < sizeof(FileHeader)) {
+        ::close(fd);
+        throw error(path_, "demasiado pequeño para ser un fichero de columnas");
+    }
+    void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // el mapeo sigue válido sin el descriptor
+    if (address == MAP_FAILED) throw error(path_, "mmap ha fallado");
+    bytes_ = static_cast<const unsigned char*>(address);
+
+    try {
+        validate();
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : path_(std::move(other.path_)),
+      bytes_(std::exchange(other.bytes_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      columns_(std::move(other.columns_)) { }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        path_ = std::move(other.path_);
+        bytes_ = std::exchange(other.bytes_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        columns_ = std::move(other.columns_);
+    }
+    return *this;
+}
+
+void MappedFile::unmap() {
+    if (bytes_ != nullptr) ::munmap(const_cast<unsigned char*>(bytes_), size_);
+    bytes_ = nullptr;
+}
+
+// Todo lo que luego se usa sin comprobar (offsets, tamaños, anchos) se
+// comprueba aquí una vez.
+void MappedFile::validate() {
+    FileHeader header{};
+    std::memcpy(&header, bytes_, sizeof(header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) throw error(path_, "no es un fichero de columnas");
+    if (header.version != formatVersion) {
+        throw error(path_, "versión " + std::to_string(header.version) + " no soportada");
+    }
+    if (header.fileSize != size_) throw error(path_, "tamaño distinto del de la cabecera (¿truncado?)");
+    if (header.directoryOffset % alignment != 0 || header.directoryOffset < sizeof(FileHeader) ||
+        header.directoryOffset > size_ ||
+        (size_ - header.directoryOffset) / sizeof(ColumnHeader) < header.columnCount) {
+        throw error(path_, "directorio fuera del fichero");
+    }
+
+    columns_.resize(header.columnCount);
+    std::memcpy(columns_.data(), bytes_ + header.directoryOffset, columns_.size() * sizeof(ColumnHeader));
+    for (const ColumnHeader& column : columns_) {
+        const std::string name{column.name, strnlen(column.name, sizeof(column.name))};
+        if (name.size() == sizeof(column.name)) throw error(path_, "nombre de columna sin terminar");
+        const std::size_t width = widthOf(column.type);
+        if (width == 0 || width != column.width) throw error(path_, "columna " + name + ": tipo o ancho inválido");
+        if (column.endianness != hostEndianness()) {
+            throw error(path_, "columna " + name + ": orden de bytes distinto del de esta máquina");
+        }
+        // Entre la cabecera y el directorio, sin pisar ninguno de los dos.
+        if (column.offset % alignment != 0 || column.offset < sizeof(FileHeader) ||
+            column.offset > header.directoryOffset ||
+            column.count > (header.directoryOffset - column.offset) / width) {
+            throw error(path_, "columna " + name + ": datos fuera del fichero");
+        }
+    }
+}
+
+std::size_t MappedFile::find(std::string_view name) const {
+    for (std::size_t index = 0; index < columns_.size(); ++index) {
+        if (name == columns_[index].name) return index;
+    }
+    throw std::out_of_range{"column_file: " + path_ + ": no hay columna " + std::string{name}};
+}
+
+void MappedFile::checkType(const ColumnHeader& column, ElementType type) const {
+    if (column.type != type) {
+        throw error(path_, std::string{"la columna "} + column.name + " es de tipo " + typeName(column.type) +
+                               ", no " + typeName(type));
+    }
+}
+
+bool MappedFile::checksumMatches(std::size_t index) const {
+    const ColumnHeader& column = header(index);
+    return checksum(bytes_ + column.offset, column.count * column.width) == column.checksum;
+}
+
+void MappedFile::verifyChecksums() const {
+    for (std::size_t index = 0; index < columns_.size(); ++index) {
+        if (!checksumMatches(index)) throw error(path_, "columna " + std::string{name(index)} + ": checksum distinto");
+    }
+}
+
+} // namespace column_file
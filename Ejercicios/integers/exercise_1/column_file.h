@@ -0,0 +1,275 @@
+#ifndef COLUMN_FILE_H
+#define COLUMN_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @namespace column_file
+ * @brief Fichero binario por columnas de enteros de ancho fijo que se lee
+ *        con mmap, sin copiar ni convertir de texto.
+ *
+ * 6-Fixed-width_integers.cpp recomienda std::int32_t y compañía cuando hay
+ * millones de enteros; aquí esos millones se guardan tal cual están en
+ * memoria y al leerlos se obtiene directamente un std::span<const T> sobre
+ * el fichero mapeado.
+ *
+ * Formato (todos los campos en el orden de bytes de la máquina que escribe,
+ * indicado en cada columna):
+ *
+ *     FileHeader                64 bytes, en el offset 0
+ *     datos de la columna 0     en un offset múltiplo de 64
+ *     datos de la columna 1     ...
+ *     ColumnHeader x columnas   64 bytes cada uno, en directoryOffset
+ *
+ * El directorio va al final para poder escribir columnas de tamaño
+ * desconocido de un tirón. Cada columna guarda tipo, ancho, orden de bytes,
+ * número de elementos y un checksum de sus datos.
+ */
+namespace column_file {
+
+/// Tipo de los elementos de una columna. El valor es el que se guarda en el fichero.
+enum class ElementType : std::uint8_t {
+    Int8 = 1,
+    Int16 = 2,
+    Int32 = 3,
+    Int64 = 4,
+    UInt8 = 5,
+    UInt16 = 6,
+    UInt32 = 7,
+    UInt64 = 8,
+};
+
+enum class Endianness : std::uint8_t { Little = 1, Big = 2 };
+
+template <typename T>
+constexpr ElementType elementTypeOf() {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "column_file: solo enteros");
+    constexpr bool isSigned = std::is_signed_v<T>;
+    if constexpr (sizeof(T) == 1) return isSigned ? ElementType::Int8 : ElementType::UInt8;
+    else if constexpr (sizeof(T) == 2) return isSigned ? ElementType::Int16 : ElementType::UInt16;
+    else if constexpr (sizeof(T) == 4) return isSigned ? ElementType::Int32 : ElementType::UInt32;
+    else {
+        static_assert(sizeof(T) == 8, "column_file: enteros de 1, 2, 4 u 8 bytes");
+        return isSigned ? ElementType::Int64 : ElementType::UInt64;
+    }
+}
+
+/// Bytes por elemento, o 0 si el tipo no es válido.
+std::size_t widthOf(ElementType type);
+const char* typeName(ElementType type);
+Endianness hostEndianness();
+
+// ----------------------------
+// Formato en disco
+// ----------------------------
+struct FileHeader {
+    char magic[8];                 // "INTCOLS\0"
+    std::uint32_t version;         // formatVersion
+    std::uint32_t columnCount;
+    std::uint64_t directoryOffset; // primer ColumnHeader
+    std::uint64_t fileSize;        // para detectar ficheros truncados
+    std::uint8_t reserved[32];
+};
+
+struct ColumnHeader {
+    char name[32];                 // terminado en '\0'
+    std::uint64_t offset;          // de los datos, múltiplo de alignment
+    std::uint64_t count;           // elementos
+    std::uint64_t checksum;        // checksum() de los datos
+    ElementType type;
+    std::uint8_t width;            // bytes por elemento; redundante con type, se comprueba al leer
+    Endianness endianness;
+    std::uint8_t reserved[5];
+};
+
+constexpr char magic[8] = {'I', 'N', 'T', 'C', 'O', 'L', 'S', '\0'};
+constexpr std::uint32_t formatVersion = 1;
+/// Alineación de los datos de cada columna: una línea de caché, válida para cualquier T.
+constexpr std::size_t alignment = 64;
+constexpr std::size_t maxNameLength = sizeof(ColumnHeader::name) - 1;
+
+// Como en 3-Object_sizes_and_SizeOf.cpp: si el compilador o la plataforma
+// no dan estos tamaños, el formato no sería el mismo y es mejor no compilar.
+static_assert(sizeof(std::int8_t) == 1 && sizeof(std::int16_t) == 2 && sizeof(std::int32_t) == 4 &&
+                  sizeof(std::int64_t) == 8,
+              "column_file: enteros de ancho fijo con tamaños inesperados");
+static_assert(sizeof(FileHeader) == 64, "column_file: FileHeader debe ocupar 64 bytes");
+static_assert(sizeof(ColumnHeader) == 64, "column_file: ColumnHeader debe ocupar 64 bytes");
+static_assert(offsetof(FileHeader, directoryOffset) == 16 && offsetof(FileHeader, fileSize) == 24,
+              "column_file: FileHeader con relleno inesperado");
+static_assert(offsetof(ColumnHeader, offset) == 32 && offsetof(ColumnHeader, type) == 56,
+              "column_file: ColumnHeader con relleno inesperado");
+static_assert(std::is_trivially_copyable_v<FileHeader> && std::is_trivially_copyable_v<ColumnHeader>,
+              "column_file: las cabeceras se escriben con memcpy");
+static_assert(alignment % alignof(std::int64_t) == 0, "column_file: alineación insuficiente");
+
+/**
+ * @brief Checksum de 64 bits de los datos de una columna.
+ *
+ * Cuatro acumuladores independientes de 64 bits (multiplicar y rotar), así
+ * que va a varios GB/s; detecta ficheros corruptos o truncados, no ataques.
+ * Se puede calcular por partes: update() con trozos de cualquier tamaño da
+ * lo mismo que con todo de una vez.
+ */
+class Checksum {
+public:
+    void update(const void* data, std::size_t size);
+    std::uint64_t value() const;
+
+private:
+    void block(const unsigned char* bytes);
+
+    std::uint64_t lanes_[4]{0x9E3779B97F4A7C15u, 0xC2B2AE3D27D4EB4Fu, 0x165667B19E3779F9u, 0x27D4EB2F165667C5u};
+    unsigned char pending_[32]{};
+    std::size_t pendingSize_{0};
+    std::uint64_t total_{0};
+};
+
+std::uint64_t checksum(const void* data, std::size_t size);
+
+// ----------------------------
+// Escritura
+// ----------------------------
+/**
+ * @class Writer
+ * @brief Escribe un fichero de columnas con fwrite en bloques grandes.
+ *
+ * @code
+ * column_file::Writer writer{"datos.cols"};
+ * writer.addColumn<std::int32_t>("edad", ages);         // de una vez
+ * writer.beginColumn<std::int64_t>("id");              // o por partes
+ * writer.append<std::int64_t>(firstBlock);
+ * writer.append<std::int64_t>(secondBlock);
+ * writer.finish();                                     // escribe el directorio
+ * @endcode
+ *
+ * Los errores (nombre repetido o largo, tipo que no coincide, fallo de E/S)
+ * lanzan std::runtime_error. Tras un fallo de E/S el Writer queda inservible:
+ * cualquier llamada posterior, finish() incluido, lanza. Si no se llama a
+ * finish(), el destructor lo intenta sin lanzar; un fichero sin directorio no
+ * se puede abrir.
+ */
+class Writer {
+public:
+    explicit Writer(const std::string& path);
+    ~Writer();
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    template <typename T>
+    void addColumn(std::string_view name, std::span<const T> values) {
+        beginColumn<T>(name);
+        append<T>(values);
+    }
+
+    template <typename T>
+    void addColumn(std::string_view name, const std::vector<T>& values) {
+        addColumn<T>(name, std::span<const T>{values});
+    }
+
+    /// Empieza una columna nueva (y termina la anterior).
+    template <typename T>
+    void beginColumn(std::string_view name) {
+        beginColumn(name, elementTypeOf<T>());
+    }
+
+    /// Añade valores a la columna abierta, que debe ser de tipo T.
+    template <typename T>
+    void append(std::span<const T> values) {
+        appendBytes(elementTypeOf<T>(), values.data(), values.size_bytes());
+    }
+
+    void finish();
+
+private:
+    void beginColumn(std::string_view name, ElementType type);
+    void appendBytes(ElementType type, const void* data, std::size_t size);
+    void endColumn();
+    void checkWritable() const;
+    void write(const void* data, std::size_t size);
+    void padTo(std::uint64_t offset);
+
+    std::string path_;
+    std::FILE* file_{nullptr};
+    std::vector<char> buffer_;
+    std::uint64_t position_{0};
+    std::vector<ColumnHeader> columns_;
+    bool open_{false}; // hay una columna abierta
+    bool failed_{false}; // una escritura falló
+    Checksum checksum_;
+};
+
+// ----------------------------
+// Lectura
+// ----------------------------
+/**
+ * @class MappedFile
+ * @brief Un fichero de columnas abierto con mmap (solo lectura).
+ *
+ * El constructor comprueba cabecera y directorio: firma, versión, tamaño
+ * del fichero, que cada columna esté entre la cabecera y el directorio, alineada, con un ancho que
+ * corresponda a su tipo y en el orden de bytes de esta máquina. No lee los
+ * datos: abrir cuesta lo mismo con 1 KB que con 10 GB, y las páginas se
+ * cargan al tocarlas. verifyChecksums() sí lee todo.
+ *
+ * Los span que devuelve column() apuntan al fichero mapeado y valen mientras
+ * exista el MappedFile.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::size_t columnCount() const { return columns_.size(); }
+    const ColumnHeader& header(std::size_t index) const { return columns_.at(index); }
+    std::string_view name(std::size_t index) const { return header(index).name; }
+
+    /// Posición de la columna con ese nombre; lanza std::out_of_range si no existe.
+    std::size_t find(std::string_view name) const;
+
+    /// Los datos de la columna, sin copiar. Lanza std::runtime_error si no es de tipo T.
+    template <typename T>
+    std::span<const T> column(std::size_t index) const {
+        const ColumnHeader& column = header(index);
+        checkType(column, elementTypeOf<T>());
+        return {reinterpret_cast<const T*>(bytes_ + column.offset), static_cast<std::size_t>(column.count)};
+    }
+
+    template <typename T>
+    std::span<const T> column(std::string_view name) const {
+        return column<T>(find(name));
+    }
+
+    bool checksumMatches(std::size_t index) const;
+
+    /// Lanza std::runtime_error con el nombre de la primera columna corrupta.
+    void verifyChecksums() const;
+
+private:
+    void validate();
+    void checkType(const ColumnHeader& column, ElementType type) const;
+    void unmap();
+
+    std::string path_;
+    const unsigned char* bytes_{nullptr};
+    std::size_t size_{0};
+    std::vector<ColumnHeader> columns_;
+};
+
+} // namespace column_file
+
+#endif // COLUMN_FILE_H
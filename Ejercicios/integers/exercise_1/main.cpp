@@ -0,0 +1,76 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "column_file.h"
+
+// Guarda una pequeña tabla de clientes (id, edad y saldo, cada columna con el
+// entero de ancho fijo justo para su rango) y la vuelve a leer con mmap.
+//
+// Uso:
+//   ./main                 (escribe y lee clientes.cols)
+//   ./main fichero.cols    (solo lee y muestra un fichero existente)
+namespace {
+
+void writeExample(const std::string& path) {
+    std::vector<std::int64_t> ids;
+    std::vector<std::uint8_t> ages;   // 0..255 años: 1 byte basta
+    std::vector<std::int32_t> balances;
+    for (std::int64_t i = 0; i < 1000; ++i) {
+        ids.push_back(1'000'000'000'000 + i);
+        ages.push_back(static_cast<std::uint8_t>(18 + i % 70));
+        balances.push_back(static_cast<std::int32_t>((i * 7919) % 20001 - 10000));
+    }
+
+    column_file::Writer writer{path};
+    writer.addColumn("id", ids);
+    writer.addColumn("edad", ages);
+    // Por partes, como si el saldo llegara en bloques.
+    writer.beginColumn<std::int32_t>("saldo");
+    writer.append<std::int32_t>(std::span{balances}.first(500));
+    writer.append<std::int32_t>(std::span{balances}.subspan(500));
+    writer.finish();
+}
+
+void printFile(const std::string& path) {
+    const column_file::MappedFile file{path};
+    std::cout << path << ": " << file.columnCount() << " columnas\n";
+    for (std::size_t i = 0; i < file.columnCount(); ++i) {
+        const column_file::ColumnHeader& column = file.header(i);
+        std::cout << "  " << file.name(i) << ": " << column.count << " x " << column_file::typeName(column.type)
+                  << " (" << static_cast<int>(column.width) << " bytes), offset " << column.offset << ", checksum "
+                  << (file.checksumMatches(i) ? "correcto" : "INCORRECTO") << '\n';
+    }
+}
+
+void printExample(const std::string& path) {
+    const column_file::MappedFile file{path};
+    const auto ages = file.column<std::uint8_t>("edad");
+    const auto balances = file.column<std::int32_t>("saldo");
+    // uint8_t se imprime como char: hay que convertirlo a int (ver 6-Fixed-width_integers.cpp).
+    std::cout << "Primera edad: " << static_cast<int>(ages.front()) << '\n';
+    std::cout << "Edad media: " << std::accumulate(ages.begin(), ages.end(), 0LL) / static_cast<double>(ages.size())
+              << '\n';
+    std::cout << "Saldo total: " << std::accumulate(balances.begin(), balances.end(), 0LL) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        const std::string path = "clientes.cols";
+        if (argc > 1) {
+            printFile(argv[1]);
+            return 0;
+        }
+        writeExample(path);
+        printFile(path);
+        printExample(path);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "packed_int_vector.h"
+
+// ----------------------------
+// Benchmark: memoria y velocidad de decodificación
+// ----------------------------
+// Para varios anchos B, N valores aleatorios de B bits (2^24 por defecto)
+// guardados en std::vector<int>, std::vector<std::uint8_t> (si B <= 8) y
+// PackedIntVector. Se muestra la memoria de cada uno y, en millones de
+// valores por segundo (mejor de 3):
+//
+// - copiar a int32_t por bloques de 4096 (lo que hace cualquier algoritmo
+//   que necesite los valores como int): std::copy desde los vectores y
+//   PackedIntVector::unpack con cada kernel;
+// - sumar recorriendo con operator[], con el ancho fijado al compilar
+//   (PackedIntVector<B>) y en tiempo de ejecución (PackedIntVector<>).
+
+namespace {
+
+volatile long long sink{0};
+
+constexpr std::size_t blockSize = 4096;
+
+template <typename F>
+double bestSeconds(F&& body) {
+    double best{1e30};
+    for (int run = 0; run < 3; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void reportMemory(const std::string& name, std::size_t bytes, std::size_t count) {
+    std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(9) << bytes / 1048576.0 << " MB" << std::setprecision(2) << std::setw(8)
+              << bytes * 8.0 / count << " bits/valor\n";
+}
+
+void reportRate(const std::string& name, std::size_t count, double seconds, bool same) {
+    std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(9) << count / seconds / 1e6 << " M/s" << (same ? "" : "   ¡RESULTADO DISTINTO!") << '\n';
+}
+
+// Copia a int32_t por bloques y devuelve la suma del último elemento de cada
+// bloque, para comprobar que todos decodifican lo mismo.
+template <typename Decode>
+long long decodeBlocks(std::size_t count, std::vector<std::int32_t>& buffer, Decode&& decode) {
+    long long check{0};
+    for (std::size_t first = 0; first < count; first += blockSize) {
+        const std::size_t size = std::min(blockSize, count - first);
+        decode(first, size, buffer.data());
+        check += buffer[size - 1];
+    }
+    return check;
+}
+
+template <typename Vector>
+long long sumByIndex(const Vector& values) {
+    long long sum{0};
+    for (std::size_t i = 0; i < values.size(); ++i) sum += static_cast<long long>(values[i]);
+    return sum;
+}
+
+template <unsigned B>
+void benchmarkWidth(std::size_t count) {
+    std::mt19937_64 rng{B};
+    std::vector<int> ints(count);
+    for (int& value : ints) value = static_cast<int>(rng() & packed_ints::detail::mask(B));
+
+    PackedIntVector<B> fixed;
+    PackedIntVector<> dynamic{B};
+    fixed.reserve(count);
+    dynamic.reserve(count);
+    for (const int value : ints) {
+        fixed.push_back(static_cast<std::uint64_t>(value));
+        dynamic.push_back(static_cast<std::uint64_t>(value));
+    }
+    std::vector<std::uint8_t> bytes;
+    if constexpr (B <= 8) bytes.assign(ints.begin(), ints.end());
+
+    std::cout << B << " bits:\n";
+    reportMemory("std::vector<int>", ints.capacity() * sizeof(int), count);
+    if constexpr (B <= 8) reportMemory("std::vector<std::uint8_t>", bytes.capacity(), count);
+    reportMemory("PackedIntVector", fixed.memoryBytes(), count);
+
+    std::vector<std::int32_t> buffer(blockSize);
+    long long expected{0};
+    double seconds = bestSeconds([&] {
+        expected = decodeBlocks(count, buffer, [&](std::size_t first, std::size_t size, std::int32_t* out) {
+            std::copy(ints.begin() + first, ints.begin() + first + size, out);
+        });
+        sink = expected;
+    });
+    reportRate("a int32: vector<int>", count, seconds, true);
+
+    if constexpr (B <= 8) {
+        long long check{0};
+        seconds = bestSeconds([&] {
+            check = decodeBlocks(count, buffer, [&](std::size_t first, std::size_t size, std::int32_t* out) {
+                std::copy(bytes.begin() + first, bytes.begin() + first + size, out);
+            });
+            sink = check;
+        });
+        reportRate("a int32: vector<uint8_t>", count, seconds, check == expected);
+    }
+
+    for (const packed_ints::Kernel kernel : {packed_ints::Kernel::Scalar, packed_ints::Kernel::Bmi2}) {
+        if (!packed_ints::forceKernel(kernel)) continue;
+        long long check{0};
+        seconds = bestSeconds([&] {
+            check = decodeBlocks(count, buffer, [&](std::size_t first, std::size_t size, std::int32_t* out) {
+                fixed.unpack(first, size, out);
+            });
+            sink = check;
+        });
+        reportRate(std::string{"a int32: unpack "} + packed_ints::kernelName(kernel), count, seconds,
+                   check == expected);
+    }
+
+    long long expectedSum{0};
+    seconds = bestSeconds([&] {
+        expectedSum = sumByIndex(ints);
+        sink = expectedSum;
+    });
+    reportRate("sumar: vector<int>", count, seconds, true);
+
+    long long sum{0};
+    seconds = bestSeconds([&] {
+        sum = sumByIndex(fixed);
+        sink = sum;
+    });
+    reportRate("sumar: PackedIntVector<" + std::to_string(B) + ">", count, seconds, sum == expectedSum);
+
+    seconds = bestSeconds([&] {
+        sum = sumByIndex(dynamic);
+        sink = sum;
+    });
+    reportRate("sumar: PackedIntVector<>", count, seconds, sum == expectedSum);
+}
+
+template <unsigned... B>
+void benchmarkWidths(std::size_t count) {
+    (benchmarkWidth<B>(count), ...);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = std::size_t{1} << 24;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+    if (count == 0) return 0;
+
+    std::cout << count << " valores\n";
+    benchmarkWidths<1, 3, 7, 12, 17, 24, 31>(count);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "packed_int_vector.h"
+
+// Lee edades hasta el final de la entrada y las guarda en 7 bits cada una
+// (de 0 a 127), como propone 6-Fixed-width_integers.cpp para millones de
+// enteros. Después muestra cuánta memoria ocupan frente a std::vector<int>
+// y la edad media.
+//
+// Uso:
+//   ./main                      (interactivo, Ctrl+D para terminar)
+//   ./main < edades.txt
+int main() {
+    PackedIntVector<7> ages;
+
+    std::cout << "Introduce edades (Ctrl+D para terminar):" << std::endl;
+    long long age{};
+    while (std::cin >> age) {
+        if (age < 0 || static_cast<std::uint64_t>(age) > ages.maxValue()) {
+            std::cout << "Edad fuera de rango (0 a " << ages.maxValue() << "): " << age << '\n';
+            continue;
+        }
+        ages.push_back(static_cast<std::uint64_t>(age));
+    }
+    if (ages.empty()) return 0;
+
+    std::cout << "Edades: " << ages.size() << '\n';
+    std::cout << "Memoria: " << ages.memoryBytes() << " bytes (std::vector<int>: " << ages.size() * sizeof(int)
+              << " bytes)\n";
+
+    // Como int32_t, de golpe.
+    std::vector<std::int32_t> values(ages.size());
+    ages.unpack(0, ages.size(), values.data());
+    long long sum{0};
+    for (const std::int32_t value : values) sum += value;
+    std::cout << "Edad media: " << static_cast<double>(sum) / static_cast<double>(ages.size()) << '\n';
+
+    // O recorriendo el vector, sin copiar.
+    std::uint64_t oldest{0};
+    for (const std::uint64_t value : ages) oldest = value > oldest ? value : oldest;
+    std::cout << "La mayor es: " << oldest << '\n';
+
+    return 0;
+}
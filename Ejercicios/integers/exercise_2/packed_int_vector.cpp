@@ -0,0 +1,194 @@
+#include "packed_int_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+// pdep solo existe en 64 bits.
+#if defined(__x86_64__)
+#define PACKED_INTS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace packed_ints {
+
+namespace {
+
+using Unpack32 = void (*)(const std::uint64_t* words, std::size_t first, std::size_t count, std::int32_t* out);
+// Un kernel por ancho (índice = bits, 1 a 31): con el ancho constante las
+// máscaras y desplazamientos son inmediatos.
+using Table = std::array<Unpack32, 32>;
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+template <unsigned B>
+void unpackEach(const std::uint64_t* words, std::size_t first, std::size_t count, std::int32_t* out) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = static_cast<std::int32_t>(detail::get(words, B, first + i));
+}
+
+// 64 valores seguidos ocupan exactamente B palabras. Desplegando el bucle,
+// la palabra y el desplazamiento de cada valor son constantes.
+template <unsigned B>
+void unpack64Values(const std::uint64_t* block, std::int32_t* out) {
+#pragma GCC unroll 64
+    for (unsigned j = 0; j < 64; ++j) {
+        const unsigned word = j * B / 64;
+        const unsigned shift = j * B % 64;
+        std::uint64_t value = block[word] >> shift;
+        if (shift + B > 64) value |= block[word + 1] << (64 - shift);
+        out[j] = static_cast<std::int32_t>(value & detail::mask(B));
+    }
+}
+
+template <unsigned B>
+void unpackScalar(const std::uint64_t* words, std::size_t first, std::size_t count, std::int32_t* out) {
+    const std::size_t head = std::min(count, (64 - first % 64) % 64);
+    unpackEach<B>(words, first, head, out);
+    std::size_t i = head;
+    for (; i + 64 <= count; i += 64) unpack64Values<B>(words + (first + i) / 64 * B, out + i);
+    unpackEach<B>(words, first + i, count - i, out + i);
+}
+
+template <std::size_t... B>
+constexpr Table makeScalarTable(std::index_sequence<B...>) {
+    return {nullptr, &unpackScalar<B + 1>...};
+}
+
+constexpr Table scalarTable = makeScalarTable(std::make_index_sequence<31>{});
+
+#ifdef PACKED_INTS_X86
+// ----------------------------
+// Kernel BMI2 + AVX2
+// ----------------------------
+// 8 valores seguidos ocupan 8 * B bits = B bytes: si el primero es múltiplo
+// de 8, el grupo empieza en un byte entero. pdep coloca cada valor de B bits
+// en su propio byte (B <= 8), palabra de 16 bits (B <= 16) o de 32 (B <= 28)
+// y AVX2 los ensancha a int32_t. Cada pdep lee de un load de 64 bits, así
+// que los valores que reparte más el desplazamiento dentro del primer byte
+// deben caber en 64 bits: de ahí el límite de 28.
+
+// pattern repetido cada lane bits.
+constexpr std::uint64_t repeat(std::uint64_t pattern, unsigned lane) {
+    std::uint64_t result{0};
+    for (unsigned shift = 0; shift < 64; shift += lane) result |= pattern << shift;
+    return result;
+}
+
+inline std::uint64_t load64(const unsigned char* bytes) {
+    std::uint64_t value{};
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// Los valores del grupo que empiezan en el bit bit (relativo al grupo), repartidos con mask.
+template <unsigned Bit>
+__attribute__((target("bmi2"), always_inline)) inline std::uint64_t spread(const unsigned char* group,
+                                                                           std::uint64_t mask) {
+    return _pdep_u64(load64(group + Bit / 8) >> (Bit % 8), mask);
+}
+
+template <unsigned B>
+__attribute__((target("bmi2,avx2"), always_inline)) inline __m256i decode8(const unsigned char* group) {
+    if constexpr (B <= 8) {
+        constexpr std::uint64_t mask = repeat(detail::mask(B), 8);
+        return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(spread<0>(group, mask))));
+    } else if constexpr (B <= 16) {
+        constexpr std::uint64_t mask = repeat(detail::mask(B), 16);
+        const __m128i words = _mm_set_epi64x(static_cast<long long>(spread<4 * B>(group, mask)),
+                                             static_cast<long long>(spread<0>(group, mask)));
+        return _mm256_cvtepu16_epi32(words);
+    } else {
+        constexpr std::uint64_t mask = repeat(detail::mask(B), 32);
+        return _mm256_set_epi64x(static_cast<long long>(spread<6 * B>(group, mask)),
+                                 static_cast<long long>(spread<4 * B>(group, mask)),
+                                 static_cast<long long>(spread<2 * B>(group, mask)),
+                                 static_cast<long long>(spread<0>(group, mask)));
+    }
+}
+
+template <unsigned B>
+__attribute__((target("bmi2,avx2"))) void unpackBmi2(const std::uint64_t* words, std::size_t first,
+                                                    std::size_t count, std::int32_t* out) {
+    if constexpr (B > 28) {
+        unpackScalar<B>(words, first, count, out);
+    } else {
+        // Hasta el principio de un grupo de 8, de uno en uno.
+        const std::size_t head = std::min(count, (8 - first % 8) % 8);
+        unpackEach<B>(words, first, head, out);
+        std::size_t i = head;
+        // La palabra de relleno cubre el load de 64 bits del último grupo.
+        const auto* bytes = reinterpret_cast<const unsigned char*>(words);
+        for (; i + 8 <= count; i += 8) {
+            const __m256i values = decode8<B>(bytes + (first + i) / 8 * B);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+        }
+        unpackEach<B>(words, first + i, count - i, out + i);
+    }
+}
+
+template <std::size_t... B>
+constexpr Table makeBmi2Table(std::index_sequence<B...>) {
+    return {nullptr, &unpackBmi2<B + 1>...};
+}
+
+constexpr Table bmi2Table = makeBmi2Table(std::make_index_sequence<31>{});
+#endif
+
+bool supports(Kernel kernel) {
+#ifdef PACKED_INTS_X86
+    if (kernel == Kernel::Bmi2) return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("avx2");
+#endif
+    return kernel == Kernel::Scalar;
+}
+
+const Table& tableFor(Kernel kernel) {
+#ifdef PACKED_INTS_X86
+    if (kernel == Kernel::Bmi2) return bmi2Table;
+#endif
+    return scalarTable;
+}
+
+struct Dispatch {
+    Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state = [] {
+        const Kernel best = supports(Kernel::Bmi2) ? Kernel::Bmi2 : Kernel::Scalar;
+        return Dispatch{best, &tableFor(best)};
+    }();
+    return state;
+}
+
+} // namespace
+
+Kernel activeKernel() {
+    return dispatch().kernel;
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    return kernel == Kernel::Bmi2 ? "BMI2+AVX2" : "escalar";
+}
+
+void unpack(const std::uint64_t* words, unsigned bits, std::size_t first, std::size_t count, std::int32_t* out) {
+    // La tabla solo tiene kernels de 1 a 31 bits (la entrada 0 está vacía).
+    if (bits == 0 || bits > 31) {
+        throw std::invalid_argument{"packed_ints::unpack: " + std::to_string(bits) + " bits, deben ser de 1 a 31"};
+    }
+    (*dispatch().table)[bits](words, first, count, out);
+}
+
+void unpack(const std::uint64_t* words, unsigned bits, std::size_t first, std::size_t count, std::uint64_t* out) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = detail::get(words, bits, first + i);
+}
+
+} // namespace packed_ints
@@ -0,0 +1,317 @@
+#ifndef PACKED_INT_VECTOR_H
+#define PACKED_INT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace packed_ints
+ * @brief Decodificación en bloque de enteros empaquetados con un número
+ *        arbitrario de bits (de 1 a 63).
+ *
+ * Los valores se guardan uno tras otro, sin huecos, en un array de uint64_t:
+ * el elemento i ocupa los bits [i * bits, (i + 1) * bits), empezando por el
+ * bit menos significativo de words[0]. Tras el último valor hay siempre una
+ * palabra de relleno, para poder leer 64 bits sin mirar dónde acaba el array.
+ *
+ * unpack a int32_t tiene un kernel escalar y otro con BMI2 (pdep) y AVX2,
+ * elegido en tiempo de ejecución según la CPU. El escalar decodifica de 64
+ * en 64 valores (ocupan exactamente bits palabras), con la posición de cada
+ * uno constante. El de BMI2 reparte con un pdep 8 valores de hasta 8 bits
+ * en 8 bytes (o 4 de hasta 16 bits en 4 palabras de 16 bits, o 2 de hasta
+ * 28 en 2 de 32) y los ensancha a int32_t con AVX2. Con 29 a 31 bits usa el
+ * escalar.
+ */
+namespace packed_ints {
+
+/// Implementaciones disponibles.
+enum class Kernel { Scalar, Bmi2 };
+
+Kernel activeKernel();
+bool forceKernel(Kernel kernel);
+const char* kernelName(Kernel kernel);
+
+/// Ancho máximo: con 64 bits la máscara (1 << bits) - 1 no existiría.
+constexpr unsigned maxBits = 63;
+
+/// Bits necesarios para guardar valores de 0 a maxValue (al menos 1; 64 no es un ancho válido).
+constexpr unsigned bitsFor(std::uint64_t maxValue) {
+    unsigned bits = 1;
+    while (bits < 64 && (maxValue >> bits) != 0) ++bits;
+    return bits;
+}
+
+/// words + count elementos a partir de first, cada uno de bits <= 31 bits, a int32_t.
+/// Lanza std::invalid_argument si bits no está entre 1 y 31.
+void unpack(const std::uint64_t* words, unsigned bits, std::size_t first, std::size_t count, std::int32_t* out);
+
+/// Igual, para cualquier ancho, a uint64_t (solo escalar).
+void unpack(const std::uint64_t* words, unsigned bits, std::size_t first, std::size_t count, std::uint64_t* out);
+
+namespace detail {
+
+constexpr std::uint64_t mask(unsigned bits) {
+    return (std::uint64_t{1} << bits) - 1;
+}
+
+/// Palabras para count elementos, más la de relleno.
+constexpr std::size_t wordsFor(std::size_t count, unsigned bits) {
+    return (count * bits + 63) / 64 + 1;
+}
+
+// (next << 1) << (63 - shift) es 0 cuando shift es 0, sin el desplazamiento
+// de 64 bits que sería comportamiento indefinido.
+inline std::uint64_t get(const std::uint64_t* words, unsigned bits, std::size_t index) {
+    const std::size_t position = index * bits;
+    const std::size_t word = position / 64;
+    const unsigned shift = position % 64;
+    return ((words[word] >> shift) | ((words[word + 1] << 1) << (63 - shift))) & mask(bits);
+}
+
+inline void set(std::uint64_t* words, unsigned bits, std::size_t index, std::uint64_t value) {
+    const std::size_t position = index * bits;
+    const std::size_t word = position / 64;
+    const unsigned shift = position % 64;
+    words[word] = (words[word] & ~(mask(bits) << shift)) | (value << shift);
+    if (shift + bits > 64) {
+        const unsigned high = 64 - shift;
+        words[word + 1] = (words[word + 1] & ~(mask(bits) >> high)) | (value >> high);
+    }
+}
+
+} // namespace detail
+
+} // namespace packed_ints
+
+/**
+ * @class PackedIntVector
+ * @brief Vector de enteros sin signo de Bits bits cada uno.
+ *
+ * 6-Fixed-width_integers.cpp explica que, con millones de enteros, los bytes
+ * que sobran importan. Una edad cabe en 7 bits: en un std::vector<int> ocupa
+ * 32 y en un std::vector<std::uint8_t> 8; aquí ocupa 7.
+ *
+ * El ancho se fija en tiempo de compilación (PackedIntVector<7>) o, con
+ * Bits = 0, en tiempo de ejecución (PackedIntVector<>{bits}). Con el ancho
+ * conocido al compilar, operator[] se reduce a dos desplazamientos y una
+ * máscara constantes.
+ *
+ * @code
+ * PackedIntVector<7> ages;
+ * ages.push_back(42);                           // 200 lanzaría std::out_of_range
+ * std::uint64_t first = ages[0];
+ * std::vector<std::int32_t> all(ages.size());
+ * ages.unpack(0, ages.size(), all.data());      // BMI2 + AVX2 si la CPU los tiene
+ *
+ * PackedIntVector<> ids{packed_ints::bitsFor(maxId)};
+ * @endcode
+ *
+ * Como std::vector<bool>, operator[] devuelve el valor y no una referencia:
+ * para modificar se usa set().
+ */
+template <unsigned Bits = 0>
+class PackedIntVector {
+    static_assert(Bits <= packed_ints::maxBits, "PackedIntVector: de 1 a 63 bits");
+
+public:
+    using value_type = std::uint64_t;
+    using size_type = std::size_t;
+
+    /// Iterador de acceso aleatorio de solo lectura; al desreferenciarlo da el valor.
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::uint64_t;
+        using pointer = void;
+
+        const_iterator() = default;
+
+        std::uint64_t operator*() const { return (*this)[0]; }
+        std::uint64_t operator[](difference_type offset) const {
+            // Con Bits fijo, el ancho es una constante y el compilador lo aprovecha.
+            return packed_ints::detail::get(words_, Bits != 0 ? Bits : bits_, index_ + offset);
+        }
+
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator old = *this; --index_; return old; }
+        const_iterator& operator+=(difference_type offset) { index_ += offset; return *this; }
+        const_iterator& operator-=(difference_type offset) { index_ -= offset; return *this; }
+        const_iterator operator+(difference_type offset) const { return {words_, bits_, index_ + offset}; }
+        const_iterator operator-(difference_type offset) const { return {words_, bits_, index_ - offset}; }
+        friend const_iterator operator+(difference_type offset, const const_iterator& it) { return it + offset; }
+        difference_type operator-(const const_iterator& other) const { return index_ - other.index_; }
+
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+        bool operator>(const const_iterator& other) const { return index_ > other.index_; }
+        bool operator<=(const const_iterator& other) const { return index_ <= other.index_; }
+        bool operator>=(const const_iterator& other) const { return index_ >= other.index_; }
+
+    private:
+        friend class PackedIntVector;
+
+        const_iterator(const std::uint64_t* words, unsigned bits, difference_type index)
+            : words_(words), bits_(bits), index_(index) { }
+
+        const std::uint64_t* words_{nullptr};
+        unsigned bits_{0};
+        difference_type index_{0};
+    };
+
+    using iterator = const_iterator;
+
+    /// count ceros, con el ancho Bits fijado al compilar.
+    template <unsigned B = Bits, std::enable_if_t<B != 0, int> = 0>
+    explicit PackedIntVector(std::size_t count = 0) : bits_(Bits) {
+        resize(count);
+    }
+
+    /// count ceros de bits bits. Lanza std::invalid_argument si bits no está entre 1 y 63.
+    template <unsigned B = Bits, std::enable_if_t<B == 0, int> = 0>
+    explicit PackedIntVector(unsigned bits, std::size_t count = 0) : bits_(bits) {
+        if (bits == 0 || bits > packed_ints::maxBits) {
+            throw std::invalid_argument{"PackedIntVector: " + std::to_string(bits) + " bits, deben ser de 1 a 63"};
+        }
+        resize(count);
+    }
+
+    PackedIntVector(const PackedIntVector&) = default;
+    PackedIntVector& operator=(const PackedIntVector&) = default;
+
+    /// El vector de origen queda vacío (size() == 0) y utilizable, con su palabra de relleno.
+    PackedIntVector(PackedIntVector&& other)
+        : bits_(other.bits_), size_(std::exchange(other.size_, 0)), words_(std::move(other.words_)) {
+        other.words_.assign(1, 0);
+    }
+
+    PackedIntVector& operator=(PackedIntVector&& other) {
+        if (this != &other) {
+            bits_ = other.bits_;
+            size_ = std::exchange(other.size_, 0);
+            words_ = std::move(other.words_);
+            other.words_.assign(1, 0);
+        }
+        return *this;
+    }
+
+    unsigned bits() const {
+        if constexpr (Bits != 0) {
+            return Bits;
+        } else {
+            return bits_;
+        }
+    }
+
+    /// El mayor valor que cabe: 2^bits - 1.
+    std::uint64_t maxValue() const { return packed_ints::detail::mask(bits()); }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /// Bytes reservados para los valores (lo que ocuparía std::vector::capacity() * sizeof(T)).
+    std::size_t memoryBytes() const { return words_.capacity() * sizeof(std::uint64_t); }
+
+    void reserve(std::size_t count) { words_.reserve(packed_ints::detail::wordsFor(count, bits())); }
+
+    /// Al crecer, los nuevos valores son 0.
+    void resize(std::size_t count) {
+        // Invariante: los bits a partir del último valor son 0, así que
+        // crecer y push_back no tienen que limpiar nada.
+        if (count < size_ && count * bits() % 64 != 0) {
+            words_[count * bits() / 64] &= packed_ints::detail::mask(count * bits() % 64);
+        }
+        words_.resize(packed_ints::detail::wordsFor(count, bits()));
+        if (count < size_) words_.back() = 0;
+        size_ = count;
+    }
+
+    void clear() { resize(0); }
+
+    /// Lanza std::out_of_range si value no cabe en bits() bits.
+    void push_back(std::uint64_t value) {
+        checkValue(value);
+        const std::size_t words = packed_ints::detail::wordsFor(size_ + 1, bits());
+        if (words > words_.size()) words_.resize(words);
+        packed_ints::detail::set(words_.data(), bits(), size_, value);
+        ++size_;
+    }
+
+    std::uint64_t operator[](std::size_t index) const { return packed_ints::detail::get(words_.data(), bits(), index); }
+
+    std::uint64_t at(std::size_t index) const {
+        checkIndex(index);
+        return (*this)[index];
+    }
+
+    /// Lanza std::out_of_range si index no existe o value no cabe en bits() bits.
+    void set(std::size_t index, std::uint64_t value) {
+        checkIndex(index);
+        checkValue(value);
+        packed_ints::detail::set(words_.data(), bits(), index, value);
+    }
+
+    /**
+     * @brief Copia count valores a partir de first en out, como int32_t.
+     *
+     * Lanza std::out_of_range si el rango no existe y std::invalid_argument si
+     * los valores pueden no caber en int32_t (más de 31 bits).
+     */
+    void unpack(std::size_t first, std::size_t count, std::int32_t* out) const {
+        if (bits() > 31) {
+            throw std::invalid_argument{"PackedIntVector: " + std::to_string(bits()) + " bits no caben en int32_t"};
+        }
+        checkRange(first, count);
+        packed_ints::unpack(words_.data(), bits(), first, count, out);
+    }
+
+    void unpack(std::size_t first, std::size_t count, std::uint64_t* out) const {
+        checkRange(first, count);
+        packed_ints::unpack(words_.data(), bits(), first, count, out);
+    }
+
+    /// Las palabras con los valores empaquetados (formato en packed_ints).
+    const std::uint64_t* data() const { return words_.data(); }
+
+    const_iterator begin() const { return {words_.data(), bits(), 0}; }
+    const_iterator end() const { return {words_.data(), bits(), static_cast<std::ptrdiff_t>(size_)}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+private:
+    void checkIndex(std::size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range{"PackedIntVector: posición " + std::to_string(index) + " de " +
+                                    std::to_string(size_)};
+        }
+    }
+
+    void checkValue(std::uint64_t value) const {
+        if (value > maxValue()) {
+            throw std::out_of_range{"PackedIntVector: " + std::to_string(value) + " no cabe en " +
+                                    std::to_string(bits()) + " bits"};
+        }
+    }
+
+    void checkRange(std::size_t first, std::size_t count) const {
+        if (first > size_ || count > size_ - first) {
+            throw std::out_of_range{"PackedIntVector: rango fuera del vector"};
+        }
+    }
+
+    unsigned bits_;
+    std::size_t size_{0};
+    std::vector<std::uint64_t> words_;
+};
+
+#endif // PACKED_INT_VECTOR_H
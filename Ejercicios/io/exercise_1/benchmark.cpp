@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "int_reader.h"
+
+// ----------------------------
+// Benchmark: enteros por segundo
+// ----------------------------
+// Genera un fichero con enteros de 64 bits de longitudes variadas (con signo,
+// separados por espacios y saltos de línea) y lo lee redirigiendo stdin con
+// freopen: std::cin >> x, scanf("%lld") e IntReader con y sin SWAR.
+
+namespace {
+
+struct Result {
+    std::size_t count{};
+    // Para comprobar que todos leen lo mismo. Sin signo: la suma desborda y
+    // así da la vuelta (módulo 2^64) en lugar de ser comportamiento indefinido.
+    unsigned long long sum{};
+};
+
+template <typename F>
+void run(std::string_view name, const std::string& path, F&& readAll) {
+    if (std::freopen(path.c_str(), "rb", stdin) == nullptr) {
+        std::cerr << "No se pudo abrir " << path << '\n';
+        std::exit(1);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const Result result = readAll();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << std::left << std::setw(26) << name << std::right
+              << std::setw(12) << result.count
+              << std::setw(24) << result.sum
+              << std::setw(12) << std::fixed << std::setprecision(1) << result.count / seconds / 1e6 << " M enteros/s\n";
+}
+
+Result readWithIntReader(bool swar) {
+    IntReader reader{stdin};
+    reader.setSwar(swar);
+    Result result{};
+    long long value{};
+    while (reader.read(value) == IntReader::Status::Ok) {
+        ++result.count;
+        result.sum += static_cast<unsigned long long>(value);
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 10'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    const std::string path = "int_reader_bench.txt";
+    {
+        std::mt19937_64 rng{7};
+        std::ofstream out{path, std::ios::binary};
+        for (std::size_t i = 0; i < count; ++i) {
+            // Longitud uniforme entre 1 y 18 dígitos: mezcla de edades, ids y contadores.
+            const unsigned digits = 1 + static_cast<unsigned>(rng() % 18);
+            long long modulus = 1;
+            for (unsigned d = 0; d < digits; ++d) modulus *= 10;
+            long long value = static_cast<long long>(rng() % static_cast<unsigned long long>(modulus));
+            if (rng() % 4 == 0) value = -value;
+            out << value << (i % 16 == 15 ? '\n' : ' ');
+        }
+    }
+
+    std::cout << std::left << std::setw(26) << "método" << std::right << std::setw(12) << "enteros"
+              << std::setw(24) << "suma" << std::setw(12) << "velocidad" << '\n';
+
+    run("std::cin >> x", path, [] {
+        Result result{};
+        long long value{};
+        while (std::cin >> value) {
+            ++result.count;
+            result.sum += static_cast<unsigned long long>(value);
+        }
+        std::cin.clear();
+        return result;
+    });
+
+    run("scanf(\"%lld\")", path, [] {
+        Result result{};
+        long long value{};
+        while (std::scanf("%lld", &value) == 1) {
+            ++result.count;
+            result.sum += static_cast<unsigned long long>(value);
+        }
+        return result;
+    });
+
+    run("IntReader (from_chars)", path, [] { return readWithIntReader(false); });
+    run("IntReader (SWAR)", path, [] { return readWithIntReader(true); });
+
+    std::remove(path.c_str());
+    return 0;
+}
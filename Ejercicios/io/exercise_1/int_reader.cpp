@@ -0,0 +1,203 @@
+#include "int_reader.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define INT_READER_HAS_POSIX_READ 1
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Mismos caracteres que salta std::ws en la locale "C".
+bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10u;
+}
+
+// ----------------------------
+// SWAR: 8 dígitos en un uint64_t
+// ----------------------------
+// Con memcpy el primer carácter queda en el byte bajo (little-endian).
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define INT_READER_SWAR 1
+
+std::uint64_t load8(const char* text) {
+    std::uint64_t chunk{};
+    std::memcpy(&chunk, text, sizeof(chunk));
+    return chunk;
+}
+
+// Todos los bytes entre '0' (0x30) y '9' (0x39): el nibble alto es 3 y
+// sumar 6 no hace que el nibble bajo pase de 0xF.
+bool allDigits8(std::uint64_t chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+            (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+// Combina los dígitos por parejas, luego grupos de 4 y luego de 8: tres
+// multiplicaciones en lugar de ocho.
+std::uint64_t parse8(std::uint64_t chunk) {
+    chunk = (chunk & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;                 // 10 * 2^8 + 1
+    chunk = (chunk & 0x00FF00FF00FF00FFull) * 6553601 >> 16;             // 100 * 2^16 + 1
+    return (chunk & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32;    // 10000 * 2^32 + 1
+}
+
+// Máscara con el bit alto de cada byte <= 0x20 (todos los espacios lo son).
+// Es exacta para bytes < 0x80; los demás se filtran con isSpace después.
+std::uint64_t lowBytes8(std::uint64_t chunk) {
+    return (chunk - 0x2121212121212121ull) & ~chunk & 0x8080808080808080ull;
+}
+#endif
+
+// Posición del primer espacio en [position, end), o end si no hay.
+std::size_t findSpace(const char* bytes, std::size_t position, std::size_t end) {
+#ifdef INT_READER_SWAR
+    while (position + 8 <= end) {
+        std::uint64_t candidates = lowBytes8(load8(bytes + position));
+        while (candidates != 0) {
+            const std::size_t index = position + static_cast<std::size_t>(__builtin_ctzll(candidates)) / 8;
+            if (isSpace(bytes[index])) return index;
+            candidates &= candidates - 1;
+        }
+        position += 8;
+    }
+#endif
+    while (position < end && !isSpace(bytes[position])) ++position;
+    return position;
+}
+
+} // namespace
+
+IntReader::IntReader(std::FILE* file, std::size_t blockSize)
+    : file_(file), eof_(file == nullptr), buffer_(blockSize > 0 ? blockSize : defaultBlockSize) { }
+
+std::string_view IntReader::lastToken() const {
+    return std::string_view{buffer_.data() + tokenBegin_, tokenSize_};
+}
+
+void IntReader::setSwar(bool enabled) {
+    swar_ = enabled;
+}
+
+bool IntReader::swar() const {
+    return swar_;
+}
+
+// Mueve los bytes pendientes al principio del buffer y lee otro bloque detrás.
+// Si un token no cabe en el buffer, el buffer crece al doble.
+// En POSIX se usa read(), que devuelve lo que haya disponible: así funciona
+// también al escribir a mano en la consola, no solo con ficheros y tuberías.
+bool IntReader::refill() {
+    if (eof_) return false;
+
+    if (begin_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+    }
+    if (end_ == buffer_.size()) buffer_.resize(buffer_.size() * 2);
+
+#ifdef INT_READER_HAS_POSIX_READ
+    ssize_t bytesRead{};
+    do {
+        bytesRead = ::read(fileno(file_), buffer_.data() + end_, buffer_.size() - end_);
+    } while (bytesRead < 0 && errno == EINTR);
+    if (bytesRead <= 0) {
+        eof_ = true;
+        return false;
+    }
+    end_ += static_cast<std::size_t>(bytesRead);
+#else
+    const std::size_t bytesRead = std::fread(buffer_.data() + end_, 1, buffer_.size() - end_, file_);
+    if (bytesRead == 0) {
+        eof_ = true;
+        return false;
+    }
+    end_ += bytesRead;
+#endif
+    return true;
+}
+
+bool IntReader::nextToken(std::string_view& token) {
+    // 1. Saltar espacios en blanco.
+    while (true) {
+        while (begin_ < end_ && isSpace(buffer_[begin_])) ++begin_;
+        if (begin_ < end_) break;
+        if (!refill()) {
+            tokenSize_ = 0;
+            return false;
+        }
+    }
+
+    // 2. Buscar el final del token; si no está en el buffer, leer más.
+    std::size_t position = begin_;
+    while (true) {
+        position = findSpace(buffer_.data(), position, end_);
+        if (position < end_) break;
+        const std::size_t consumed = position - begin_;
+        if (!refill()) break; // último token sin espacio final
+        position = begin_ + consumed; // refill() ha movido los datos al inicio
+    }
+
+    tokenBegin_ = begin_;
+    tokenSize_ = position - begin_;
+    begin_ = position;
+    token = lastToken();
+    return true;
+}
+
+void IntReader::skipLine() {
+    while (true) {
+        const void* newline = std::memchr(buffer_.data() + begin_, '\n', end_ - begin_);
+        if (newline != nullptr) {
+            begin_ = static_cast<std::size_t>(static_cast<const char*>(newline) - buffer_.data()) + 1;
+            return;
+        }
+        begin_ = end_;
+        if (!refill()) return;
+    }
+}
+
+IntReader::Status IntReader::parseDecimal(std::string_view token, std::uint64_t& magnitude, bool& negative) {
+    negative = false;
+    if (!token.empty() && (token.front() == '-' || token.front() == '+')) {
+        negative = token.front() == '-';
+        token.remove_prefix(1);
+    }
+    if (token.empty()) return Status::BadToken;
+
+    // Los ceros a la izquierda no cuentan para el desbordamiento.
+    while (token.size() > 1 && token.front() == '0') token.remove_prefix(1);
+
+    std::uint64_t result{0};
+    std::size_t i{0};
+#ifdef INT_READER_SWAR
+    // Hasta 16 dígitos en bloques de 8 no pueden desbordar (10^16 < 2^64).
+    for (; i + 8 <= token.size() && i < 16; i += 8) {
+        const std::uint64_t chunk = load8(token.data() + i);
+        if (!allDigits8(chunk)) return Status::BadToken;
+        result = result * 100000000u + parse8(chunk - 0x3030303030303030ull);
+    }
+#endif
+    // Resto dígito a dígito. Con 19 dígitos o menos no hay desbordamiento
+    // posible (10^19 < 2^64); uint64_t tiene como mucho 20.
+    const bool mayOverflow = token.size() > 19;
+    bool overflow{false};
+    for (; i < token.size(); ++i) {
+        const char c = token[i];
+        if (!isDigit(c)) return Status::BadToken;
+        const auto digit = static_cast<std::uint64_t>(c - '0');
+        if (mayOverflow && result > (std::numeric_limits<std::uint64_t>::max() - digit) / 10) overflow = true;
+        result = result * 10 + digit;
+    }
+    // Como con std::from_chars, un token con basura es BadToken aunque además sea enorme.
+    if (overflow) return Status::Overflow;
+
+    magnitude = result;
+    return Status::Ok;
+}
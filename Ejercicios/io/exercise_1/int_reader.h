@@ -0,0 +1,142 @@
+#ifndef INT_READER_H
+#define INT_READER_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class IntReader
+ * @brief Lee enteros separados por espacios en blanco sin pasar por iostream.
+ *
+ * Sustituye a los bucles `std::cin >> x`: lee la entrada en bloques grandes y
+ * convierte cada token con std::from_chars (o con un parser SWAR que procesa
+ * 8 dígitos a la vez), sin locale ni sentry por cada número.
+ *
+ * A diferencia de `std::cin >> x`, un token se acepta o se rechaza entero:
+ * "12abc" es BadToken, no 12 seguido de "abc". Se admite un '+' inicial.
+ *
+ * No hay que mezclarlo con std::cin ni scanf sobre el mismo fichero: el lector
+ * se queda con los bytes que ha leído por adelantado.
+ */
+class IntReader {
+public:
+    /// Resultado de read().
+    enum class Status {
+        Ok,       ///< value contiene el número.
+        End,      ///< No quedan tokens.
+        Overflow, ///< Solo dígitos, pero no cabe en el tipo pedido.
+        BadToken  ///< El token no es un entero.
+    };
+
+    /// Tamaño de bloque por defecto.
+    static constexpr std::size_t defaultBlockSize = std::size_t{1} << 20;
+
+    /**
+     * @brief Lector sobre un FILE* ya abierto (por ejemplo stdin).
+     * @param file Fichero del que leer. El lector no lo cierra.
+     * @param blockSize Tamaño de cada lectura.
+     */
+    explicit IntReader(std::FILE* file, std::size_t blockSize = defaultBlockSize);
+
+    IntReader(const IntReader&) = delete;
+    IntReader& operator=(const IntReader&) = delete;
+
+    /**
+     * @brief Lee el siguiente entero.
+     * @param value Recibe el número; no se modifica si el resultado no es Ok.
+     * @return Ok, End, Overflow o BadToken. Tras un error el token ya está
+     *         consumido, se puede consultar con lastToken().
+     */
+    template <typename T>
+    Status read(T& value);
+
+    /// Descarta el resto de la línea actual, como cin.ignore(max, '\n').
+    void skipLine();
+
+    /// Último token leído. Válido hasta la siguiente llamada a read() o skipLine().
+    std::string_view lastToken() const;
+
+    /// Activa o desactiva el parser SWAR (activo por defecto). Sin él se usa solo std::from_chars.
+    void setSwar(bool enabled);
+    bool swar() const;
+
+private:
+    bool nextToken(std::string_view& token);
+    bool refill();
+
+    // Parser SWAR: valida el token y obtiene su magnitud en 64 bits.
+    static Status parseDecimal(std::string_view token, std::uint64_t& magnitude, bool& negative);
+
+    template <typename T>
+    static Status narrow(std::uint64_t magnitude, bool negative, T& value);
+
+    std::FILE* file_{nullptr};
+    bool eof_{false};
+    bool swar_{true};
+
+    // Bytes pendientes en buffer_[begin_, end_).
+    std::vector<char> buffer_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    std::size_t tokenBegin_{0};
+    std::size_t tokenSize_{0};
+};
+
+template <typename T>
+IntReader::Status IntReader::narrow(std::uint64_t magnitude, bool negative, T& value) {
+    using Unsigned = std::make_unsigned_t<T>;
+    if constexpr (std::is_signed_v<T>) {
+        const auto maxMagnitude = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1u : 0u);
+        if (magnitude > maxMagnitude) return Status::Overflow;
+        // Negar en unsigned evita el desbordamiento con el mínimo del tipo.
+        const auto bits = static_cast<Unsigned>(negative ? Unsigned{0} - static_cast<Unsigned>(magnitude)
+                                                         : static_cast<Unsigned>(magnitude));
+        value = static_cast<T>(bits);
+    } else {
+        // std::from_chars tampoco acepta '-' en tipos sin signo, ni siquiera "-0".
+        if (negative) return Status::BadToken;
+        if (magnitude > std::numeric_limits<T>::max()) return Status::Overflow;
+        value = static_cast<T>(magnitude);
+    }
+    return Status::Ok;
+}
+
+template <typename T>
+IntReader::Status IntReader::read(T& value) {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "IntReader::read necesita un tipo entero");
+
+    std::string_view token{};
+    if (!nextToken(token)) return Status::End;
+
+    if constexpr (sizeof(T) <= sizeof(std::uint64_t)) {
+        if (swar_) {
+            std::uint64_t magnitude{};
+            bool negative{};
+            const Status status = parseDecimal(token, magnitude, negative);
+            if (status != Status::Ok) return status;
+            return narrow(magnitude, negative, value);
+        }
+    }
+
+    // std::from_chars no acepta '+': se quita aquí, pero "+-5" sigue siendo inválido.
+    if (token.size() > 1 && token.front() == '+') {
+        token.remove_prefix(1);
+        if (token.front() == '-') return Status::BadToken;
+    }
+    T parsed{};
+    const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), parsed);
+    if (end != token.data() + token.size()) return Status::BadToken;
+    if (error == std::errc::result_out_of_range) return Status::Overflow;
+    if (error != std::errc{}) return Status::BadToken;
+    value = parsed;
+    return Status::Ok;
+}
+
+#endif // INT_READER_H
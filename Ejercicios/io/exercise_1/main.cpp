@@ -0,0 +1,45 @@
+#include <cstdio>
+#include <iostream>
+#include "int_reader.h"
+
+// Mismo bucle de validación que Ejercicios/conditionals/exercise_2/main.cpp,
+// pero con IntReader en lugar de std::cin >> age. Después suma todos los
+// números que queden en la entrada, avisando de los que no se pueden leer.
+//
+// Uso:
+//   ./main                      (interactivo)
+//   ./main < numeros.txt
+int main() {
+    IntReader reader{stdin};
+
+    int age{};
+    std::cout << "Introduce tu edad: " << std::flush;
+
+    // Control de errores de entrada
+    IntReader::Status status{};
+    while ((status = reader.read(age)) != IntReader::Status::Ok) {
+        if (status == IntReader::Status::End) return 1;
+        // El token solo es válido hasta skipLine(): se muestra antes de descartar la línea.
+        if (status == IntReader::Status::Overflow) {
+            std::cout << "Número fuera de rango (" << reader.lastToken() << "). Introduce un número entero: " << std::flush;
+        } else {
+            std::cout << "Entrada inválida (" << reader.lastToken() << "). Introduce un número entero: " << std::flush;
+        }
+        reader.skipLine(); // descartar el resto de la línea, como cin.ignore
+    }
+    std::cout << "Edad: " << age << '\n';
+
+    std::cout << "Introduce más números (Ctrl+D para terminar):" << std::endl;
+    long long sum{0};
+    long long value{};
+    while ((status = reader.read(value)) != IntReader::Status::End) {
+        if (status == IntReader::Status::Ok) {
+            sum += value;
+        } else {
+            std::cout << "Ignorado: " << reader.lastToken() << '\n';
+        }
+    }
+    std::cout << "Suma: " << sum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <fcntl.h>
+#include <unistd.h>
+#include "output_sink.h"
+
+// ----------------------------
+// Benchmark: llamadas al sistema y velocidad de escritura
+// ----------------------------
+// Escribe N líneas "Línea i: valor x\n" en un fichero (la salida estándar se
+// redirige con dup2 durante cada prueba) con std::cout + std::endl,
+// std::cout + '\n' y OutputSink. Las llamadas a write se leen de
+// /proc/self/io (campo syscw), así que el conteo solo está en Linux.
+// Requiere POSIX (dup/dup2).
+
+namespace {
+
+long long writeSyscalls() {
+    std::ifstream io{"/proc/self/io"};
+    std::string key{};
+    long long value{};
+    while (io >> key >> value) {
+        if (key == "syscw:") return value;
+    }
+    return -1;
+}
+
+template <typename F>
+void run(std::string_view name, const std::string& path, std::size_t lines, F&& writeAll) {
+    const int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    const int savedStdout = ::dup(1);
+    ::dup2(file, 1);
+
+    const long long syscallsBefore = writeSyscalls();
+    const auto start = std::chrono::steady_clock::now();
+    writeAll(lines);
+    const auto stop = std::chrono::steady_clock::now();
+    const long long syscallsAfter = writeSyscalls();
+
+    std::cout.flush();
+    ::dup2(savedStdout, 1);
+    ::close(savedStdout);
+    const long long bytes = ::lseek(file, 0, SEEK_END);
+    ::close(file);
+
+    // La siguiente prueba escribe números con std::cout: se restaura su formato.
+    const std::ios::fmtflags flags = std::cout.flags();
+    const std::streamsize precision = std::cout.precision();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << std::left << std::setw(22) << name << std::right
+              << std::setw(12) << bytes
+              << std::setw(12) << (syscallsBefore < 0 ? -1 : syscallsAfter - syscallsBefore)
+              << std::setw(12) << std::fixed << std::setprecision(1) << seconds * 1e3 << " ms"
+              << std::setw(10) << std::setprecision(1) << bytes / seconds / 1e6 << " MB/s" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t lines = 2'000'000;
+    if (argc > 1) lines = std::strtoull(argv[1], nullptr, 10);
+
+    const std::string path = "output_sink_bench.txt";
+    std::cout << std::left << std::setw(22) << "método" << std::right << std::setw(12) << "bytes"
+              << std::setw(12) << "syscalls" << std::setw(15) << "tiempo" << std::setw(15) << "velocidad" << '\n';
+    std::cout.flush();
+
+    run("cout + std::endl", path, lines, [](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) std::cout << "Línea " << i << ": valor " << (i % 1000) * 0.5 << std::endl;
+    });
+
+    run("cout + '\\n'", path, lines, [](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) std::cout << "Línea " << i << ": valor " << (i % 1000) * 0.5 << '\n';
+        std::cout.flush();
+    });
+
+    run("OutputSink (OnSize)", path, lines, [](std::size_t n) {
+        OutputSink out{1, OutputSink::FlushPolicy::OnSize};
+        for (std::size_t i = 0; i < n; ++i) out << "Línea " << i << ": valor " << (i % 1000) * 0.5 << '\n';
+    });
+
+    run("OutputSink (1 MB)", path, lines, [](std::size_t n) {
+        OutputSink out{1, OutputSink::FlushPolicy::OnSize, std::size_t{1} << 20};
+        for (std::size_t i = 0; i < n; ++i) out << "Línea " << i << ": valor " << (i % 1000) * 0.5 << '\n';
+    });
+
+    std::remove(path.c_str());
+    return 0;
+}
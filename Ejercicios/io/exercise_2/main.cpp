@@ -0,0 +1,30 @@
+#include "output_sink.h"
+
+// Las mismas salidas que 4-iostream.cpp, pero a través de OutputSink.
+// Con la política por defecto (LineIfTty) cada línea aparece al momento en la
+// consola; redirigido a un fichero (./main > salida.txt) todo sale en una
+// sola llamada a write() al final.
+int main() {
+    OutputSink out{};
+
+    out << "Hola mundo!\n";
+    out << "El número es: " << 42 << '\n';
+
+    // Nada de std::endl: '\n' y, si de verdad hace falta, flush() explícito.
+    out << "Hola" << '\n';
+    out.flush();
+    out << "Mundo" << '\n';
+
+    const double third = 1.0 / 3.0;
+    out << "1/3 (más corto exacto): " << third << '\n';
+    out << "1/3 (fijo, 4 decimales): ";
+    out.writeFixed(third, 4).put('\n');
+    out << "0.1 + 0.2 = " << 0.1 + 0.2 << '\n';
+
+    for (int i = 1; i <= 3; ++i) out << "Línea " << i << " de " << 3u << '\n';
+
+    out << "Política: " << (out.policy() == OutputSink::FlushPolicy::LineIfTty ? "LineIfTty" : "OnSize") << '\n';
+    out << "Llamadas a write hasta ahora: " << out.syscalls() << '\n';
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include "output_sink.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OUTPUT_SINK_POSIX 1
+#include <cerrno>
+#include <sys/uio.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#endif
+
+namespace {
+
+bool isTerminal(int fd) {
+#ifdef OUTPUT_SINK_POSIX
+    return ::isatty(fd) != 0;
+#elif defined(_WIN32)
+    return ::_isatty(fd) != 0;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+} // namespace
+
+OutputSink::OutputSink(int fd, FlushPolicy policy, std::size_t capacity)
+    : fd_(fd),
+      policy_(policy == FlushPolicy::LineIfTty && !isTerminal(fd) ? FlushPolicy::OnSize : policy),
+      buffer_(std::max<std::size_t>(capacity, 64)) { }
+
+OutputSink::~OutputSink() {
+    flush();
+}
+
+bool OutputSink::good() const {
+    return good_;
+}
+
+OutputSink::FlushPolicy OutputSink::policy() const {
+    return policy_;
+}
+
+std::size_t OutputSink::syscalls() const {
+    return syscalls_;
+}
+
+// ----------------------------
+// Llamadas al sistema
+// ----------------------------
+// write() puede escribir menos de lo pedido (tuberías, señales): se repite
+// hasta terminar o hasta un error real.
+bool OutputSink::writeAll(const char* data, std::size_t size) {
+    while (size > 0) {
+        ++syscalls_;
+#ifdef OUTPUT_SINK_POSIX
+        const ssize_t written = ::write(fd_, data, size);
+        if (written < 0 && errno == EINTR) continue;
+#elif defined(_WIN32)
+        const int written = ::_write(fd_, data, static_cast<unsigned>(std::min<std::size_t>(size, 1u << 30)));
+#endif
+        if (written <= 0) {
+            good_ = false;
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+// Buffer + bloque grande en una sola llamada con writev, sin copiar el bloque.
+bool OutputSink::writeTwo(const char* first, std::size_t firstSize, const char* second, std::size_t secondSize) {
+#ifdef OUTPUT_SINK_POSIX
+    iovec parts[2] = {{const_cast<char*>(first), firstSize}, {const_cast<char*>(second), secondSize}};
+    ssize_t written{};
+    do {
+        ++syscalls_;
+        written = ::writev(fd_, parts, 2);
+    } while (written < 0 && errno == EINTR);
+    if (written < 0) {
+        good_ = false;
+        return false;
+    }
+    // Escritura parcial: el resto con write().
+    const auto done = static_cast<std::size_t>(written);
+    if (done < firstSize) {
+        return writeAll(first + done, firstSize - done) && writeAll(second, secondSize);
+    }
+    return writeAll(second + (done - firstSize), secondSize - (done - firstSize));
+#else
+    return writeAll(first, firstSize) && writeAll(second, secondSize);
+#endif
+}
+
+bool OutputSink::flush() {
+    if (size_ == 0) return good_;
+    writeAll(buffer_.data(), size_);
+    size_ = 0;
+    return good_;
+}
+
+// ----------------------------
+// Buffer
+// ----------------------------
+char* OutputSink::reserve(std::size_t size) {
+    if (size_ + size > buffer_.size()) {
+        if (policy_ != FlushPolicy::ExplicitOnly) flush();
+        if (size_ + size > buffer_.size()) {
+            buffer_.resize(std::max(buffer_.size() * 2, size_ + size));
+        }
+    }
+    return buffer_.data() + size_;
+}
+
+void OutputSink::afterWrite(bool hasNewline) {
+    if (hasNewline && policy_ == FlushPolicy::LineIfTty) flush();
+}
+
+OutputSink& OutputSink::write(std::string_view text) {
+    const bool hasNewline = policy_ == FlushPolicy::LineIfTty &&
+                            std::memchr(text.data(), '\n', text.size()) != nullptr;
+
+    // Un bloque que no cabe ni en el buffer vacío se envía directamente junto
+    // con lo pendiente, en lugar de copiarlo por partes.
+    if (policy_ != FlushPolicy::ExplicitOnly && size_ + text.size() > buffer_.size() &&
+        text.size() >= buffer_.size()) {
+        writeTwo(buffer_.data(), size_, text.data(), text.size());
+        size_ = 0;
+        return *this;
+    }
+
+    std::memcpy(reserve(text.size()), text.data(), text.size());
+    size_ += text.size();
+    afterWrite(hasNewline);
+    return *this;
+}
+
+OutputSink& OutputSink::put(char c) {
+    *reserve(1) = c;
+    ++size_;
+    afterWrite(c == '\n');
+    return *this;
+}
+
+// ----------------------------
+// Formato
+// ----------------------------
+// Se convierte directamente dentro del buffer con std::to_chars: ni locale
+// ni cadenas temporales.
+OutputSink& OutputSink::writeInt(long long value) {
+    constexpr std::size_t maxSize = std::numeric_limits<long long>::digits10 + 3;
+    char* out = reserve(maxSize);
+    size_ += static_cast<std::size_t>(std::to_chars(out, out + maxSize, value).ptr - out);
+    return *this;
+}
+
+OutputSink& OutputSink::writeUnsigned(unsigned long long value) {
+    constexpr std::size_t maxSize = std::numeric_limits<unsigned long long>::digits10 + 2;
+    char* out = reserve(maxSize);
+    size_ += static_cast<std::size_t>(std::to_chars(out, out + maxSize, value).ptr - out);
+    return *this;
+}
+
+OutputSink& OutputSink::writeDouble(double value) {
+    constexpr std::size_t maxSize = 32; // "-d.ddddddddddddddddde-308" cabe de sobra
+    char* out = reserve(maxSize);
+    size_ += static_cast<std::size_t>(std::to_chars(out, out + maxSize, value).ptr - out);
+    return *this;
+}
+
+OutputSink& OutputSink::writeFixed(double value, int precision) {
+    precision = std::max(precision, 0);
+    // Signo + hasta 309 dígitos enteros + punto + decimales.
+    const std::size_t maxSize = std::numeric_limits<double>::max_exponent10 + 3 + static_cast<std::size_t>(precision);
+    char* out = reserve(maxSize);
+    size_ += static_cast<std::size_t>(
+        std::to_chars(out, out + maxSize, value, std::chars_format::fixed, precision).ptr - out);
+    return *this;
+}
+
+OutputSink& operator<<(OutputSink& sink, std::string_view text) {
+    return sink.write(text);
+}
+
+OutputSink& operator<<(OutputSink& sink, const char* text) {
+    return sink.write(text);
+}
+
+OutputSink& operator<<(OutputSink& sink, char c) {
+    return sink.put(c);
+}
+
+OutputSink& operator<<(OutputSink& sink, double value) {
+    return sink.writeDouble(value);
+}
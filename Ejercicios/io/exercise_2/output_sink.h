@@ -0,0 +1,110 @@
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class OutputSink
+ * @brief Salida con un buffer grande propio y una política de vaciado explícita.
+ *
+ * Sustituye a escribir por std::cout a trozos mezclando std::endl y '\n': todo
+ * se acumula en el buffer y se envía al descriptor con write() (o writev()
+ * cuando un bloque grande no cabe en el buffer), así que el número de llamadas
+ * al sistema depende del tamaño del buffer y no de cuántas líneas se escriben.
+ *
+ * Al destruirse vacía lo pendiente. No hay que mezclarlo con std::cout o
+ * printf sobre el mismo descriptor sin vaciar antes uno de los dos.
+ */
+class OutputSink {
+public:
+    /// Cuándo se envía el buffer al descriptor (además de al llamar a flush()).
+    enum class FlushPolicy {
+        OnSize,      ///< Solo cuando el buffer se llena.
+        LineIfTty,   ///< Tras cada '\n' si el descriptor es una terminal; si no, como OnSize.
+        ExplicitOnly ///< Nunca por sí solo: el buffer crece hasta que se llama a flush().
+    };
+
+    /// Capacidad por defecto del buffer.
+    static constexpr std::size_t defaultCapacity = std::size_t{1} << 16;
+
+    /**
+     * @brief Crea un sink sobre un descriptor ya abierto.
+     * @param fd Descriptor (1 = salida estándar, 2 = error). El sink no lo cierra.
+     * @param policy Política de vaciado.
+     * @param capacity Tamaño del buffer.
+     */
+    explicit OutputSink(int fd = 1, FlushPolicy policy = FlushPolicy::LineIfTty,
+                        std::size_t capacity = defaultCapacity);
+
+    ~OutputSink();
+
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    /// Escribe el texto tal cual.
+    OutputSink& write(std::string_view text);
+
+    /// Escribe un carácter.
+    OutputSink& put(char c);
+
+    /// Escribe un entero en base 10.
+    OutputSink& writeInt(long long value);
+    OutputSink& writeUnsigned(unsigned long long value);
+
+    /// Escribe un double con la representación más corta que se lee igual.
+    OutputSink& writeDouble(double value);
+
+    /// Escribe un double con precision decimales fijos, como std::fixed << std::setprecision.
+    OutputSink& writeFixed(double value, int precision);
+
+    /**
+     * @brief Envía todo lo pendiente al descriptor.
+     * @return false si alguna escritura ha fallado (ver good()).
+     */
+    bool flush();
+
+    /// false si alguna escritura al descriptor ha fallado; lo que no se pudo escribir se descarta.
+    bool good() const;
+
+    /// Política que se está aplicando (LineIfTty ya resuelto a OnSize si no es terminal).
+    FlushPolicy policy() const;
+
+    /// Número de llamadas a write/writev hechas hasta ahora.
+    std::size_t syscalls() const;
+
+private:
+    // Reserva size bytes al final del buffer (vaciando o creciendo si hace falta).
+    char* reserve(std::size_t size);
+    void afterWrite(bool hasNewline);
+    bool writeAll(const char* data, std::size_t size);
+    bool writeTwo(const char* first, std::size_t firstSize, const char* second, std::size_t secondSize);
+
+    int fd_;
+    FlushPolicy policy_;
+    bool good_{true};
+    std::size_t syscalls_{0};
+
+    std::vector<char> buffer_;
+    std::size_t size_{0};
+};
+
+/// Operadores de inserción para escribir como con std::cout.
+OutputSink& operator<<(OutputSink& sink, std::string_view text);
+OutputSink& operator<<(OutputSink& sink, const char* text);
+OutputSink& operator<<(OutputSink& sink, char c);
+OutputSink& operator<<(OutputSink& sink, double value);
+
+template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                                                  !std::is_same_v<T, char>>>
+OutputSink& operator<<(OutputSink& sink, T value) {
+    if constexpr (std::is_signed_v<T>) {
+        return sink.writeInt(value);
+    } else {
+        return sink.writeUnsigned(value);
+    }
+}
+
+#endif // OUTPUT_SINK_H
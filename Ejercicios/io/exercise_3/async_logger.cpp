@@ -0,0 +1,282 @@
+#include "async_logger.h"
+
+#include <charconv>
+#include <chrono>
+#include <stdexcept>
+
+namespace async_log {
+
+namespace {
+
+// ----------------------------
+// Registro de formatos
+// ----------------------------
+// Tabla global de tamaño fijo: el hilo de fondo la lee sin bloqueo, porque
+// cada entrada se escribe antes de publicar su identificador.
+std::array<const char*, maxFormats> formats{};
+std::atomic<std::size_t> formatCount{0};
+std::mutex formatMutex{};
+
+std::atomic<std::uint64_t> nextLoggerId{1};
+
+// Caché por hilo: el buffer de este hilo en el último Logger usado.
+struct ThreadCache {
+    std::uint64_t loggerId;
+    Ring* ring;
+};
+thread_local ThreadCache threadCache{0, nullptr};
+
+constexpr std::size_t writeThreshold = std::size_t{1} << 16;
+
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t power{64};
+    while (power < value) power <<= 1;
+    return power;
+}
+
+} // namespace
+
+FormatId registerFormat(const char* format) {
+    const std::lock_guard<std::mutex> lock{formatMutex};
+    const std::size_t index = formatCount.load(std::memory_order_relaxed);
+    if (index == maxFormats) throw std::length_error{"async_log: demasiados formatos"};
+    formats[index] = format;
+    formatCount.store(index + 1, std::memory_order_release);
+    return static_cast<FormatId>(index);
+}
+
+std::uint64_t nowNanoseconds() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// ----------------------------
+// Ring
+// ----------------------------
+Ring::Ring(std::size_t capacity, std::thread::id owner)
+    : owner_(owner),
+      capacity_(roundUpToPowerOfTwo(capacity)),
+      mask_(capacity_ - 1),
+      buffer_(new char[capacity_]) { }
+
+// El productor solo lee tail_ (del consumidor) cuando su copia en caché dice
+// que no hay sitio: casi siempre reservar es aritmética local.
+char* Ring::reserve(std::size_t size) {
+    std::uint64_t head = headLocal_;
+    const std::size_t toEnd = capacity_ - (head & mask_);
+    const std::size_t needed = toEnd < size ? toEnd + size : size;
+    if (head + needed - cachedTail_ > capacity_) {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        if (head + needed - cachedTail_ > capacity_) return nullptr;
+    }
+    if (toEnd < size) {
+        // Marca de salto: solo tamaño y formato (pueden quedar solo 8 bytes).
+        const std::uint32_t marker[2] = {static_cast<std::uint32_t>(toEnd), wrapMarker};
+        std::memcpy(buffer_.get() + (head & mask_), marker, sizeof(marker));
+        head += toEnd;
+        headLocal_ = head; // se publica junto con el registro en commit()
+    }
+    return buffer_.get() + (head & mask_);
+}
+
+void Ring::commit(std::size_t size) {
+    headLocal_ += size;
+    head_.store(headLocal_, std::memory_order_release);
+}
+
+void Ring::release(std::uint64_t tail) {
+    tailLocal_ = tail;
+    tail_.store(tail, std::memory_order_release);
+}
+
+// ----------------------------
+// Logger: productores
+// ----------------------------
+Logger::Logger(std::FILE* out, std::size_t ringCapacity)
+    : out_(out),
+      ringCapacity_(ringCapacity),
+      id_(nextLoggerId.fetch_add(1, std::memory_order_relaxed)),
+      startTime_(nowNanoseconds()) {
+    line_.reserve(writeThreshold * 2);
+    worker_ = std::thread{[this] { run(); }};
+}
+
+Logger::~Logger() {
+    {
+        const std::lock_guard<std::mutex> lock{wakeMutex_};
+        stop_.store(true, std::memory_order_release);
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+std::size_t Logger::dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+Ring* Logger::threadRing() {
+    ThreadCache& cache = threadCache;
+    if (cache.loggerId == id_) return cache.ring;
+    Ring* ring = registerThread();
+    if (ring != nullptr) cache = ThreadCache{id_, ring};
+    return ring;
+}
+
+// Primera vez que este hilo usa este Logger (o vuelve a él tras usar otro).
+Ring* Logger::registerThread() {
+    const std::lock_guard<std::mutex> lock{registerMutex_};
+    const std::thread::id self = std::this_thread::get_id();
+    for (const auto& ring : ownedRings_) {
+        if (ring->owner() == self) return ring.get();
+    }
+    const std::size_t count = ringCount_.load(std::memory_order_relaxed);
+    if (count == maxThreads) return nullptr;
+
+    ownedRings_.push_back(std::make_unique<Ring>(ringCapacity_, self));
+    rings_[count].store(ownedRings_.back().get(), std::memory_order_release);
+    ringCount_.store(count + 1, std::memory_order_release);
+    return ownedRings_.back().get();
+}
+
+char* Logger::writeString(char* out, std::string_view text) {
+    *out++ = static_cast<char>(Tag::String);
+    const auto size = static_cast<std::uint32_t>(text.size());
+    std::memcpy(out, &size, sizeof(size));
+    out += sizeof(size);
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+void Logger::flush() {
+    const std::uint64_t target = flushRequested_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    wake_.notify_one();
+    std::unique_lock<std::mutex> lock{wakeMutex_};
+    flushed_.wait(lock, [&] { return flushDone_.load(std::memory_order_acquire) >= target; });
+}
+
+// ----------------------------
+// Logger: hilo de fondo
+// ----------------------------
+void Logger::run() {
+    while (true) {
+        const std::uint64_t flushTarget = flushRequested_.load(std::memory_order_acquire);
+        const bool stopping = stop_.load(std::memory_order_acquire);
+        const bool worked = drainAll();
+
+        if (stopping || flushTarget != flushDone_.load(std::memory_order_relaxed)) {
+            std::fflush(out_);
+            {
+                const std::lock_guard<std::mutex> lock{wakeMutex_};
+                flushDone_.store(flushTarget, std::memory_order_release);
+            }
+            flushed_.notify_all();
+        }
+        if (stopping) return;
+
+        if (!worked) {
+            // Sin trabajo: dormir un poco, o hasta que pidan flush o parar.
+            std::unique_lock<std::mutex> lock{wakeMutex_};
+            wake_.wait_for(lock, std::chrono::microseconds{200}, [&] {
+                return stop_.load(std::memory_order_relaxed) ||
+                       flushRequested_.load(std::memory_order_relaxed) != flushTarget;
+            });
+        }
+    }
+}
+
+bool Logger::drainAll() {
+    bool worked{false};
+    const std::size_t count = ringCount_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < count; ++i) {
+        Ring& ring = *rings_[i].load(std::memory_order_acquire);
+        if (ring.head() != ring.tail()) {
+            drain(ring);
+            worked = true;
+        }
+    }
+    if (!line_.empty()) {
+        std::fwrite(line_.data(), 1, line_.size(), out_);
+        line_.clear();
+    }
+    return worked;
+}
+
+void Logger::drain(Ring& ring) {
+    const std::uint64_t head = ring.head();
+    std::uint64_t tail = ring.tail();
+    while (tail != head) {
+        const char* record = ring.at(tail);
+        std::uint32_t sizeAndFormat[2];
+        std::memcpy(sizeAndFormat, record, sizeof(sizeAndFormat));
+        if (sizeAndFormat[1] != Ring::wrapMarker) {
+            Ring::Header header{};
+            std::memcpy(&header, record, sizeof(header));
+            format(header, record + sizeof(header), record + header.size);
+            if (line_.size() >= writeThreshold) {
+                std::fwrite(line_.data(), 1, line_.size(), out_);
+                line_.clear();
+            }
+        }
+        tail += sizeAndFormat[0];
+    }
+    ring.release(tail);
+}
+
+// "[segundos.microsegundos] mensaje\n", con cada "{}" sustituido por el
+// siguiente argumento.
+void Logger::format(const Ring::Header& header, const char* payload, const char* end) {
+    char number[32];
+    auto appendNumber = [&](auto value) {
+        line_.append(number, std::to_chars(number, number + sizeof(number), value).ptr);
+    };
+
+    const std::uint64_t elapsed = header.timestamp >= startTime_ ? header.timestamp - startTime_ : 0;
+    const std::uint64_t micros = elapsed / 1000;
+    line_.push_back('[');
+    appendNumber(micros / 1'000'000);
+    line_.push_back('.');
+    const std::uint64_t fraction = micros % 1'000'000;
+    for (std::uint64_t digit = 100'000; digit > 0; digit /= 10) {
+        line_.push_back(static_cast<char>('0' + fraction / digit % 10));
+    }
+    line_.append("] ");
+
+    const char* text = header.formatId < formatCount.load(std::memory_order_acquire) ? formats[header.formatId]
+                                                                                       : "<formato desconocido>";
+    for (const char* p = text; *p != '\0'; ++p) {
+        if (p[0] != '{' || p[1] != '}' || payload >= end) {
+            line_.push_back(*p);
+            continue;
+        }
+        ++p; // salta también la '}'
+        const auto tag = static_cast<Tag>(*payload++);
+        if (tag == Tag::String) {
+            std::uint32_t size{};
+            std::memcpy(&size, payload, sizeof(size));
+            payload += sizeof(size);
+            line_.append(payload, size);
+            payload += size;
+            continue;
+        }
+        std::uint64_t bits{};
+        std::memcpy(&bits, payload, sizeof(bits));
+        payload += sizeof(bits);
+        switch (tag) {
+        case Tag::Signed: appendNumber(static_cast<long long>(bits)); break;
+        case Tag::Unsigned: appendNumber(static_cast<unsigned long long>(bits)); break;
+        case Tag::Bool: line_.append(bits != 0 ? "true" : "false"); break;
+        case Tag::Char: line_.push_back(static_cast<char>(bits)); break;
+        case Tag::Double: {
+            double value{};
+            std::memcpy(&value, &bits, sizeof(value));
+            appendNumber(value);
+            break;
+        }
+        case Tag::String: break;
+        }
+    }
+    line_.push_back('\n');
+}
+
+} // namespace async_log
@@ -0,0 +1,250 @@
+#ifndef ASYNC_LOGGER_H
+#define ASYNC_LOGGER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @namespace async_log
+ * @brief Registro asíncrono: el hilo que escribe solo copia bytes.
+ *
+ * En lugar de formatear con std::cout en el camino crítico, quien registra
+ * guarda un registro binario (identificador de formato + argumentos) en un
+ * buffer circular propio de su hilo (un productor, un consumidor, sin
+ * bloqueos). Un hilo de fondo lee todos los buffers, formatea y escribe por
+ * lotes.
+ *
+ * Uso:
+ * @code
+ * async_log::Logger logger{stdout};
+ * ASYNC_LOG(logger, "Hola {}, tienes {} años", name, age);
+ * @endcode
+ */
+namespace async_log {
+
+/// Índice de una cadena de formato registrada con registerFormat().
+using FormatId = std::uint32_t;
+
+/**
+ * @brief Registra una cadena de formato con marcadores "{}".
+ * @param format Debe vivir toda la ejecución (normalmente un literal).
+ * @return Identificador para Logger::log(). Lanza std::length_error si se
+ *         supera maxFormats.
+ */
+FormatId registerFormat(const char* format);
+
+/// Número máximo de formatos distintos.
+constexpr std::size_t maxFormats = 4096;
+
+/// Nanosegundos de reloj monótono (la marca de tiempo de cada registro).
+std::uint64_t nowNanoseconds();
+
+/**
+ * @class Ring
+ * @brief Buffer circular de bytes con un productor y un consumidor.
+ *
+ * Los registros son contiguos y alineados a 8 bytes; si uno no cabe al final,
+ * se deja una marca de salto y se escribe desde el principio.
+ */
+class Ring {
+public:
+    /// Cabecera de cada registro.
+    struct Header {
+        std::uint32_t size;     ///< Bytes del registro completo, cabecera incluida.
+        std::uint32_t formatId; ///< wrapMarker = salto al principio del buffer.
+        std::uint64_t timestamp;
+    };
+    static constexpr std::uint32_t wrapMarker = 0xFFFFFFFFu;
+
+    /// capacity se redondea a potencia de 2; owner es el hilo productor.
+    Ring(std::size_t capacity, std::thread::id owner);
+
+    // Productor.
+    char* reserve(std::size_t size);
+    void commit(std::size_t size);
+
+    // Consumidor: [tail, head) son registros publicados.
+    std::uint64_t head() const { return head_.load(std::memory_order_acquire); }
+    std::uint64_t tail() const { return tailLocal_; }
+    const char* at(std::uint64_t index) const { return buffer_.get() + (index & mask_); }
+    std::size_t bytesToEnd(std::uint64_t index) const { return capacity_ - (index & mask_); }
+    void release(std::uint64_t tail);
+
+    std::thread::id owner() const { return owner_; }
+
+private:
+    std::thread::id owner_;
+    std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<char[]> buffer_;
+
+    // Productor y consumidor en líneas de caché distintas.
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t headLocal_{0};
+    std::uint64_t cachedTail_{0};
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t tailLocal_{0};
+};
+
+/**
+ * @class Logger
+ * @brief Dueño de los buffers de cada hilo y del hilo que escribe.
+ */
+class Logger {
+public:
+    /// Tamaño por defecto del buffer de cada hilo productor.
+    static constexpr std::size_t defaultRingCapacity = std::size_t{1} << 20;
+    /// Número máximo de hilos productores distintos.
+    static constexpr std::size_t maxThreads = 256;
+
+    /**
+     * @param out Fichero de salida (no se cierra).
+     * @param ringCapacity Bytes del buffer de cada hilo.
+     */
+    explicit Logger(std::FILE* out, std::size_t ringCapacity = defaultRingCapacity);
+
+    /// Escribe todo lo pendiente y para el hilo de fondo.
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief Guarda un registro. Argumentos admitidos: enteros, bool, char,
+     *        float, double, const char*, std::string_view y std::string (las
+     *        cadenas se copian).
+     * @return false si el buffer del hilo está lleno: el registro se descarta
+     *         (y se cuenta en dropped()) en lugar de bloquear.
+     */
+    template <typename... Args>
+    bool log(FormatId format, const Args&... args);
+
+    /// Espera a que todo lo registrado antes de la llamada esté escrito.
+    void flush();
+
+    /// Registros descartados por buffer lleno.
+    std::size_t dropped() const;
+
+private:
+    enum class Tag : std::uint8_t { Signed, Unsigned, Double, Bool, Char, String };
+
+    Ring* threadRing();
+    Ring* registerThread();
+    bool drainAll();
+    void drain(Ring& ring);
+    void format(const Ring::Header& header, const char* payload, const char* end);
+    void run();
+
+    template <typename T>
+    static std::size_t argumentSize(const T& value);
+    template <typename T>
+    static char* writeArgument(char* out, const T& value);
+    static char* writeString(char* out, std::string_view text);
+
+    std::FILE* out_;
+    std::size_t ringCapacity_;
+    std::uint64_t id_;
+    std::uint64_t startTime_;
+
+    std::mutex registerMutex_;
+    std::vector<std::unique_ptr<Ring>> ownedRings_;
+    std::array<std::atomic<Ring*>, maxThreads> rings_{};
+    std::atomic<std::size_t> ringCount_{0};
+    std::atomic<std::size_t> dropped_{0};
+
+    std::atomic<bool> stop_{false};
+    std::atomic<std::uint64_t> flushRequested_{0};
+    std::atomic<std::uint64_t> flushDone_{0};
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+
+    std::string line_; // solo lo usa el hilo de fondo
+    std::thread worker_;
+};
+
+// ----------------------------
+// Codificación de argumentos
+// ----------------------------
+template <typename T>
+std::size_t Logger::argumentSize(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, char>) {
+        return 1 + sizeof(std::uint32_t) + std::string_view{value}.size();
+    } else {
+        static_assert(std::is_arithmetic_v<T>, "async_log: tipo de argumento no admitido");
+        return 1 + 8;
+    }
+}
+
+template <typename T>
+char* Logger::writeArgument(char* out, const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, char>) {
+        return writeString(out, std::string_view{value});
+    } else {
+        Tag tag{};
+        std::uint64_t bits{};
+        if constexpr (std::is_same_v<T, bool>) {
+            tag = Tag::Bool;
+            bits = value ? 1 : 0;
+        } else if constexpr (std::is_same_v<T, char>) {
+            tag = Tag::Char;
+            bits = static_cast<unsigned char>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            tag = Tag::Double;
+            const double asDouble = static_cast<double>(value);
+            std::memcpy(&bits, &asDouble, sizeof(bits));
+        } else if constexpr (std::is_signed_v<T>) {
+            tag = Tag::Signed;
+            bits = static_cast<std::uint64_t>(static_cast<long long>(value));
+        } else {
+            tag = Tag::Unsigned;
+            bits = static_cast<std::uint64_t>(value);
+        }
+        *out++ = static_cast<char>(tag);
+        std::memcpy(out, &bits, sizeof(bits));
+        return out + sizeof(bits);
+    }
+}
+
+template <typename... Args>
+bool Logger::log(FormatId format, const Args&... args) {
+    const std::size_t payload = (std::size_t{0} + ... + argumentSize(args));
+    const std::size_t size = (sizeof(Ring::Header) + payload + 7) & ~std::size_t{7};
+
+    Ring* ring = threadRing();
+    char* out = ring != nullptr ? ring->reserve(size) : nullptr;
+    if (out == nullptr) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const Ring::Header header{static_cast<std::uint32_t>(size), format, nowNanoseconds()};
+    std::memcpy(out, &header, sizeof(header));
+    [[maybe_unused]] char* cursor = out + sizeof(header);
+    ((cursor = writeArgument(cursor, args)), ...);
+    ring->commit(size);
+    return true;
+}
+
+} // namespace async_log
+
+/// Registra el formato una sola vez por punto de llamada y guarda el registro.
+#define ASYNC_LOG(logger, format, ...)                                                          \
+    do {                                                                                        \
+        static const ::async_log::FormatId asyncLogFormatId = ::async_log::registerFormat(format); \
+        (logger).log(asyncLogFormatId, ##__VA_ARGS__);                                          \
+    } while (false)
+
+#endif // ASYNC_LOGGER_H
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "async_logger.h"
+
+// ----------------------------
+// Benchmark: coste para el hilo que registra
+// ----------------------------
+// Con 1, 4 y 16 hilos productores, cada uno registra N líneas
+// "orden {} de {}: precio {} cantidad {}" y se mide cada llamada con
+// steady_clock (restando el coste medio de leer el reloj). Se compara con
+// fprintf a un fichero, que formatea y bloquea el FILE en cada llamada.
+// Los percentiles salen de todas las llamadas de todos los hilos. Si el hilo
+// de fondo no da abasto, el logger descarta en lugar de bloquear: la columna
+// "perdidos" lo muestra.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double clockOverheadNs() {
+    constexpr int samples = 100'000;
+    const auto start = Clock::now();
+    for (int i = 0; i < samples; ++i) {
+        volatile auto now = Clock::now().time_since_epoch().count();
+        (void)now;
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / samples;
+}
+
+template <typename F>
+std::vector<double> measure(std::size_t threads, std::size_t perThread, double overhead, F&& logOne) {
+    std::vector<std::vector<double>> samples(threads);
+    std::vector<std::thread> producers{};
+    for (std::size_t t = 0; t < threads; ++t) {
+        producers.emplace_back([&, t] {
+            std::vector<double>& mine = samples[t];
+            mine.reserve(perThread);
+            for (std::size_t i = 0; i < perThread; ++i) {
+                const auto start = Clock::now();
+                logOne(t, i);
+                const auto stop = Clock::now();
+                mine.push_back(std::max(0.0, std::chrono::duration<double, std::nano>(stop - start).count() - overhead));
+            }
+        });
+    }
+    for (std::thread& producer : producers) producer.join();
+
+    std::vector<double> all{};
+    for (const auto& mine : samples) all.insert(all.end(), mine.begin(), mine.end());
+    std::sort(all.begin(), all.end());
+    return all;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    const auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+void report(std::string_view name, std::size_t threads, const std::vector<double>& sorted, double seconds,
+            std::size_t dropped) {
+    std::cout << std::left << std::setw(10) << name << std::right << std::setw(4) << threads << std::fixed
+              << std::setprecision(0) << std::setw(9) << percentile(sorted, 0.50) << std::setw(9)
+              << percentile(sorted, 0.90) << std::setw(9) << percentile(sorted, 0.99) << std::setw(10)
+              << percentile(sorted, 0.999) << std::setw(11) << sorted.back() << std::setw(10) << std::setprecision(1)
+              << seconds * 1e3 << " ms" << std::setw(10) << dropped << '\n';
+    std::cout.flush();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t perThread = 200'000;
+    if (argc > 1) perThread = std::strtoull(argv[1], nullptr, 10);
+
+    const double overhead = clockOverheadNs();
+    std::cout << "coste de leer el reloj: " << std::fixed << std::setprecision(1) << overhead << " ns (restado)\n";
+    std::cout << "latencias en ns por llamada; tiempo = hasta escribir todo en disco\n";
+    std::cout << std::left << std::setw(10) << "método" << std::right << std::setw(4) << "hil" << std::setw(9) << "p50"
+              << std::setw(9) << "p90" << std::setw(9) << "p99" << std::setw(10) << "p99.9" << std::setw(11) << "max"
+              << std::setw(13) << "tiempo" << std::setw(10) << "perdidos" << '\n';
+
+    for (const std::size_t threads : {1, 4, 16}) {
+        {
+            std::FILE* file = std::fopen("async_logger_bench.txt", "w");
+            const auto start = Clock::now();
+            std::size_t dropped{};
+            std::vector<double> sorted{};
+            {
+                async_log::Logger logger{file, std::size_t{1} << 24};
+                sorted = measure(threads, perThread, overhead, [&](std::size_t t, std::size_t i) {
+                    ASYNC_LOG(logger, "orden {} de {}: precio {} cantidad {}", i, t, 100.25 + static_cast<double>(i % 100),
+                              static_cast<int>(i % 50));
+                });
+                logger.flush();
+                dropped = logger.dropped();
+            }
+            const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            std::fclose(file);
+            report("async", threads, sorted, seconds, dropped);
+        }
+        {
+            std::FILE* file = std::fopen("fprintf_bench.txt", "w");
+            const auto start = Clock::now();
+            const std::vector<double> sorted = measure(threads, perThread, overhead, [&](std::size_t t, std::size_t i) {
+                std::fprintf(file, "orden %zu de %zu: precio %g cantidad %d\n", i, t,
+                             100.25 + static_cast<double>(i % 100), static_cast<int>(i % 50));
+            });
+            std::fflush(file);
+            const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            std::fclose(file);
+            report("fprintf", threads, sorted, seconds, 0);
+        }
+    }
+    std::remove("async_logger_bench.txt");
+    std::remove("fprintf_bench.txt");
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "async_logger.h"
+
+// Varios hilos registran a la vez; el hilo de fondo intercala sus líneas por
+// buffer (el orden entre hilos distintos no está garantizado, el de cada
+// hilo sí).
+int main() {
+    async_log::Logger logger{stdout};
+
+    const std::string name = "Ana";
+    ASYNC_LOG(logger, "Hola {}, tienes {} años", name, 30);
+    ASYNC_LOG(logger, "pi = {}, 1/3 = {}, activo = {}, inicial = {}", 3.141592653589793, 1.0 / 3.0, true, 'A');
+    ASYNC_LOG(logger, "Sin argumentos");
+
+    std::vector<std::thread> workers{};
+    for (int t = 0; t < 3; ++t) {
+        workers.emplace_back([&logger, t] {
+            for (int i = 0; i < 3; ++i) ASYNC_LOG(logger, "hilo {}: mensaje {}", t, i);
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    // flush() espera a que todo lo anterior esté escrito.
+    logger.flush();
+    std::printf("-- flush completado, descartados: %zu --\n", logger.dropped());
+
+    ASYNC_LOG(logger, "Última línea: se escribe al destruir el logger");
+    return 0;
+}
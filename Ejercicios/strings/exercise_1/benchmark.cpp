@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "sv_algorithms.h"
+
+// ----------------------------
+// Benchmark: sv_algo frente a std::string_view::find y compañía
+// ----------------------------
+// Para cada tamaño se repite la operación hasta procesar ~256 MB en total,
+// así los tamaños pequeños no quedan dominados por el ruido del reloj.
+
+namespace {
+
+// Evita que el optimizador elimine los resultados.
+volatile std::size_t sink{};
+
+template <typename F>
+double measureGBs(std::size_t bytesPerCall, F&& call) {
+    constexpr std::size_t targetBytes = 256u << 20;
+    const std::size_t iterations = std::max<std::size_t>(1, targetBytes / std::max<std::size_t>(1, bytesPerCall));
+
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t acc = 0;
+    for (std::size_t i = 0; i < iterations; ++i) acc += call();
+    const auto stop = std::chrono::steady_clock::now();
+    sink = acc;
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    return static_cast<double>(bytesPerCall) * static_cast<double>(iterations) / seconds / 1e9;
+}
+
+void printRow(std::string_view name, std::size_t size, double stdGBs, double algoGBs) {
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(12) << size
+              << std::setw(12) << std::fixed << std::setprecision(2) << stdGBs
+              << std::setw(12) << algoGBs
+              << std::setw(10) << algoGBs / stdGBs << "x\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t maxBytes = std::size_t{1} << 30; // 1 GB
+    if (argc > 1) maxBytes = std::strtoull(argv[1], nullptr, 10);
+
+    std::cout << "Kernel: " << sv_algo::kernelName(sv_algo::activeKernel()) << '\n';
+    std::cout << std::left << std::setw(12) << "operación" << std::right << std::setw(12) << "bytes"
+              << std::setw(12) << "std GB/s" << std::setw(12) << "sv GB/s" << std::setw(11) << "mejora" << '\n';
+
+    // Texto de letras minúsculas sin el carácter buscado; la aguja va al final
+    // para obligar a recorrerlo entero.
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> letter{'a', 'w'};
+    std::string buffer(maxBytes, 'a');
+    for (char& c : buffer) c = static_cast<char>(letter(rng));
+
+    for (std::size_t size = 16; size <= maxBytes; size *= 4) {
+        std::string_view text{buffer.data(), size};
+        buffer[size - 1] = 'z';
+
+        printRow("findByte", size,
+                 measureGBs(size, [&] { return text.find('z'); }),
+                 measureGBs(size, [&] { return sv_algo::findByte(text, 'z'); }));
+
+        buffer.replace(size - 4, 4, "eyzz"); // la primera letra es frecuente en el texto
+        printRow("find", size,
+                 measureGBs(size, [&] { return text.find("eyzz"); }),
+                 measureGBs(size, [&] { return sv_algo::find(text, "eyzz"); }));
+
+        printRow("findAnyOf", size,
+                 measureGBs(size, [&] { return text.find_first_of("xyz"); }),
+                 measureGBs(size, [&] { return sv_algo::findAnyOf(text, "xyz"); }));
+
+        printRow("countByte", size,
+                 measureGBs(size, [&] { return static_cast<std::size_t>(std::count(text.begin(), text.end(), 'e')); }),
+                 measureGBs(size, [&] { return sv_algo::countByte(text, 'e'); }));
+
+        // Para split usamos 'e' como delimitador (~1 de cada 23 bytes).
+        std::vector<std::string_view> pieces;
+        printRow("split", size,
+                 measureGBs(size, [&] {
+                     pieces.clear();
+                     std::size_t start = 0;
+                     while (true) {
+                         const std::size_t end = text.find('e', start);
+                         pieces.push_back(text.substr(start, end == std::string_view::npos ? end : end - start));
+                         if (end == std::string_view::npos) break;
+                         start = end + 1;
+                     }
+                     return pieces.size();
+                 }),
+                 measureGBs(size, [&] {
+                     pieces.clear();
+                     sv_algo::split(text, 'e', pieces);
+                     return pieces.size();
+                 }));
+
+        // Restaurar los bytes modificados para el siguiente tamaño.
+        for (std::size_t i = size - 4; i < size; ++i) buffer[i] = static_cast<char>(letter(rng));
+    }
+
+    return 0;
+}
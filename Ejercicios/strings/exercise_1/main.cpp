@@ -0,0 +1,24 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "sv_algorithms.h"
+
+int main() {
+    std::cout << "Kernel en uso: " << sv_algo::kernelName(sv_algo::activeKernel()) << '\n';
+
+    // El texto es el propietario; todo lo que devolvemos son vistas sobre él.
+    std::string owner{"snowball,Peach,Hello world,Alex,John"};
+    std::string_view text{owner};
+
+    std::cout << "Primera ',' en: " << sv_algo::findByte(text, ',') << '\n';
+    std::cout << "\"world\" en: " << sv_algo::find(text, "world") << '\n';
+    std::cout << "Primera vocal mayúscula en: " << sv_algo::findAnyOf(text, "AEIOU") << '\n';
+    std::cout << "Número de 'l': " << sv_algo::countByte(text, 'l') << '\n';
+
+    // split no copia: cada pieza apunta dentro de owner.
+    for (std::string_view piece : sv_algo::split(text, ',')) {
+        std::cout << "Pieza: " << piece << " (offset " << (piece.data() - owner.data()) << ")\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,335 @@
+#include "sv_algorithms.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SV_ALGO_X86 1
+#include <immintrin.h>
+#endif
+
+namespace sv_algo {
+
+namespace {
+
+constexpr std::size_t npos = std::string_view::npos;
+
+// ----------------------------
+// Tabla de funciones por kernel
+// ----------------------------
+// Cada kernel rellena la misma tabla; las funciones públicas solo llaman
+// a través del puntero, así el coste de la detección se paga una vez.
+struct Table {
+    std::size_t (*findByte)(std::string_view, char, std::size_t);
+    std::size_t (*find)(std::string_view, std::string_view, std::size_t);
+    std::size_t (*findAnyOf)(std::string_view, std::string_view, std::size_t);
+    std::size_t (*countByte)(std::string_view, char);
+};
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+std::size_t findByteScalar(std::string_view text, char c, std::size_t pos) {
+    return text.find(c, pos);
+}
+
+std::size_t findScalar(std::string_view text, std::string_view needle, std::size_t pos) {
+    return text.find(needle, pos);
+}
+
+// Para conjuntos usamos una tabla de 256 entradas: un acceso por byte,
+// en vez de recorrer el conjunto entero como hace find_first_of.
+std::size_t findAnyOfScalar(std::string_view text, std::string_view set, std::size_t pos) {
+    std::array<bool, 256> table{};
+    for (char c : set) table[static_cast<unsigned char>(c)] = true;
+    for (std::size_t i = pos; i < text.size(); ++i) {
+        if (table[static_cast<unsigned char>(text[i])]) return i;
+    }
+    return npos;
+}
+
+std::size_t countByteScalar(std::string_view text, char c) {
+    return static_cast<std::size_t>(std::count(text.begin(), text.end(), c));
+}
+
+constexpr Table scalarTable{findByteScalar, findScalar, findAnyOfScalar, countByteScalar};
+
+#ifdef SV_ALGO_X86
+
+// ----------------------------
+// Kernel SSE4.2 (bloques de 16 bytes)
+// ----------------------------
+__attribute__((target("sse4.2")))
+std::size_t findByteSse(std::string_view text, char c, std::size_t pos) {
+    const char* data = text.data();
+    const std::size_t size = text.size();
+    const __m128i pattern = _mm_set1_epi8(c);
+    std::size_t i = pos;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+        if (mask != 0) return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+    return findByteScalar(text, c, i);
+}
+
+// Filtro "primer y último carácter": solo se compara la aguja completa
+// en las posiciones donde coinciden ambos extremos.
+__attribute__((target("sse4.2")))
+std::size_t findSse(std::string_view text, std::string_view needle, std::size_t pos) {
+    const std::size_t n = needle.size();
+    if (n == 0) return pos <= text.size() ? pos : npos;
+    if (n == 1) return findByteSse(text, needle[0], pos);
+    if (pos > text.size() || text.size() - pos < n) return npos;
+
+    const char* data = text.data();
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[n - 1]);
+    std::size_t i = pos;
+    for (; i + n - 1 + 16 <= text.size(); i += 16) {
+        const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + n - 1));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+        while (mask != 0) {
+            const std::size_t bit = static_cast<std::size_t>(__builtin_ctz(mask));
+            if (std::memcmp(data + i + bit + 1, needle.data() + 1, n - 2) == 0) return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    return findScalar(text, needle, i);
+}
+
+// pcmpestri compara cada byte del bloque con hasta 16 bytes del conjunto.
+__attribute__((target("sse4.2")))
+std::size_t findAnyOfSse(std::string_view text, std::string_view set, std::size_t pos) {
+    if (set.empty() || set.size() > 16) return findAnyOfScalar(text, set, pos);
+
+    std::array<char, 16> setBytes{};
+    std::memcpy(setBytes.data(), set.data(), set.size());
+    const __m128i needles = _mm_loadu_si128(reinterpret_cast<const __m128i*>(setBytes.data()));
+    const int setSize = static_cast<int>(set.size());
+
+    const char* data = text.data();
+    std::size_t i = pos;
+    for (; i + 16 <= text.size(); i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const int index = _mm_cmpestri(needles, setSize, block, 16,
+                                       _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+        if (index < 16) return i + static_cast<std::size_t>(index);
+    }
+    return findAnyOfScalar(text, set, i);
+}
+
+__attribute__((target("sse4.2,popcnt")))
+std::size_t countByteSse(std::string_view text, char c) {
+    const char* data = text.data();
+    const __m128i pattern = _mm_set1_epi8(c);
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= text.size(); i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        count += static_cast<std::size_t>(
+            __builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)))));
+    }
+    return count + countByteScalar(text.substr(i), c);
+}
+
+constexpr Table sseTable{findByteSse, findSse, findAnyOfSse, countByteSse};
+
+// ----------------------------
+// Kernel AVX2 (bloques de 32 bytes)
+// ----------------------------
+__attribute__((target("avx2")))
+std::size_t findByteAvx2(std::string_view text, char c, std::size_t pos) {
+    const char* data = text.data();
+    const std::size_t size = text.size();
+    const __m256i pattern = _mm256_set1_epi8(c);
+    std::size_t i = pos;
+    // Bucle desenrollado: 4 bloques por iteración y una sola rama para los cuatro.
+    for (; i + 128 <= size; i += 128) {
+        const __m256i* p = reinterpret_cast<const __m256i*>(data + i);
+        const __m256i eq0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(p + 0), pattern);
+        const __m256i eq1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(p + 1), pattern);
+        const __m256i eq2 = _mm256_cmpeq_epi8(_mm256_loadu_si256(p + 2), pattern);
+        const __m256i eq3 = _mm256_cmpeq_epi8(_mm256_loadu_si256(p + 3), pattern);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+        if (!_mm256_testz_si256(any, any)) break; // el bucle de 32 bytes localiza el byte exacto
+    }
+    for (; i + 32 <= size; i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)));
+        if (mask != 0) return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+    return findByteSse(text, c, i);
+}
+
+__attribute__((target("avx2")))
+std::size_t findAvx2(std::string_view text, std::string_view needle, std::size_t pos) {
+    const std::size_t n = needle.size();
+    if (n == 0) return pos <= text.size() ? pos : npos;
+    if (n == 1) return findByteAvx2(text, needle[0], pos);
+    if (pos > text.size() || text.size() - pos < n) return npos;
+
+    const char* data = text.data();
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[n - 1]);
+    std::size_t i = pos;
+    for (; i + n - 1 + 32 <= text.size(); i += 32) {
+        const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + n - 1));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last))));
+        while (mask != 0) {
+            const std::size_t bit = static_cast<std::size_t>(__builtin_ctz(mask));
+            if (std::memcmp(data + i + bit + 1, needle.data() + 1, n - 2) == 0) return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    return findSse(text, needle, i);
+}
+
+// Conjuntos pequeños: una comparación por byte del conjunto y un OR.
+// Con más de 8 bytes sale más a cuenta pcmpestri.
+__attribute__((target("avx2")))
+std::size_t findAnyOfAvx2(std::string_view text, std::string_view set, std::size_t pos) {
+    if (set.empty() || set.size() > 8) return findAnyOfSse(text, set, pos);
+
+    __m256i patterns[8];
+    for (std::size_t k = 0; k < set.size(); ++k) patterns[k] = _mm256_set1_epi8(set[k]);
+
+    const char* data = text.data();
+    std::size_t i = pos;
+    for (; i + 32 <= text.size(); i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i hits = _mm256_cmpeq_epi8(block, patterns[0]);
+        for (std::size_t k = 1; k < set.size(); ++k) {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, patterns[k]));
+        }
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+        if (mask != 0) return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+    return findAnyOfSse(text, set, i);
+}
+
+__attribute__((target("avx2,popcnt")))
+std::size_t countByteAvx2(std::string_view text, char c) {
+    const char* data = text.data();
+    const __m256i pattern = _mm256_set1_epi8(c);
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= text.size(); i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        count += static_cast<std::size_t>(
+            __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)))));
+    }
+    return count + countByteSse(text.substr(i), c);
+}
+
+constexpr Table avx2Table{findByteAvx2, findAvx2, findAnyOfAvx2, countByteAvx2};
+
+#endif // SV_ALGO_X86
+
+bool supports(Kernel kernel) {
+#ifdef SV_ALGO_X86
+    switch (kernel) {
+    case Kernel::Avx2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    case Kernel::Sse42:
+        return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+    case Kernel::Scalar:
+        return true;
+    }
+    return false;
+#else
+    return kernel == Kernel::Scalar;
+#endif
+}
+
+const Table& tableFor(Kernel kernel) {
+#ifdef SV_ALGO_X86
+    if (kernel == Kernel::Avx2) return avx2Table;
+    if (kernel == Kernel::Sse42) return sseTable;
+#endif
+    return scalarTable;
+}
+
+// Estado del despacho: se inicializa en la primera llamada.
+struct Dispatch {
+    Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state{bestSupportedKernel(), &tableFor(bestSupportedKernel())};
+    return state;
+}
+
+} // namespace
+
+Kernel bestSupportedKernel() {
+    if (supports(Kernel::Avx2)) return Kernel::Avx2;
+    if (supports(Kernel::Sse42)) return Kernel::Sse42;
+    return Kernel::Scalar;
+}
+
+Kernel activeKernel() {
+    return dispatch().kernel;
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Avx2: return "AVX2";
+    case Kernel::Sse42: return "SSE4.2";
+    case Kernel::Scalar: return "escalar";
+    }
+    return "?";
+}
+
+std::size_t findByte(std::string_view text, char c, std::size_t pos) {
+    if (pos >= text.size()) return npos;
+    return dispatch().table->findByte(text, c, pos);
+}
+
+std::size_t find(std::string_view text, std::string_view needle, std::size_t pos) {
+    return dispatch().table->find(text, needle, pos);
+}
+
+std::size_t findAnyOf(std::string_view text, std::string_view set, std::size_t pos) {
+    if (pos >= text.size() || set.empty()) return npos;
+    if (set.size() == 1) return findByte(text, set[0], pos);
+    return dispatch().table->findAnyOf(text, set, pos);
+}
+
+std::size_t countByte(std::string_view text, char c) {
+    return dispatch().table->countByte(text, c);
+}
+
+void split(std::string_view text, char delim, std::vector<std::string_view>& out) {
+    const auto findNext = dispatch().table->findByte;
+    std::size_t start = 0;
+    while (true) {
+        const std::size_t end = start < text.size() ? findNext(text, delim, start) : npos;
+        if (end == npos) {
+            out.push_back(text.substr(start));
+            return;
+        }
+        out.push_back(text.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+std::vector<std::string_view> split(std::string_view text, char delim) {
+    std::vector<std::string_view> pieces;
+    split(text, delim, pieces);
+    return pieces;
+}
+
+} // namespace sv_algo
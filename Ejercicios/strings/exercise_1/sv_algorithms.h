@@ -0,0 +1,71 @@
+#ifndef SV_ALGORITHMS_H
+#define SV_ALGORITHMS_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Algoritmos de búsqueda y partición sobre std::string_view.
+ *
+ * Cada función tiene tres implementaciones (escalar, SSE4.2 y AVX2). La mejor
+ * soportada por la CPU se elige la primera vez que se llama a cualquiera de ellas.
+ * Las posiciones devueltas siguen la convención de std::string_view:
+ * std::string_view::npos cuando no hay coincidencia.
+ */
+namespace sv_algo {
+
+/// Implementaciones disponibles.
+enum class Kernel { Scalar, Sse42, Avx2 };
+
+/// Devuelve el kernel que se está usando.
+Kernel activeKernel();
+
+/// Mejor kernel soportado por la CPU actual.
+Kernel bestSupportedKernel();
+
+/**
+ * @brief Fuerza un kernel concreto (útil para benchmarks y pruebas).
+ * @return false si la CPU no soporta el kernel pedido; en ese caso no cambia nada.
+ */
+bool forceKernel(Kernel kernel);
+
+/// Nombre legible del kernel.
+const char* kernelName(Kernel kernel);
+
+/**
+ * @brief Busca la primera aparición de un byte a partir de pos.
+ * @return Posición del byte o npos.
+ */
+std::size_t findByte(std::string_view text, char c, std::size_t pos = 0);
+
+/**
+ * @brief Busca la primera aparición de una subcadena a partir de pos.
+ * @return Posición del inicio de la coincidencia o npos.
+ */
+std::size_t find(std::string_view text, std::string_view needle, std::size_t pos = 0);
+
+/**
+ * @brief Busca el primer byte de text que pertenezca al conjunto set.
+ * @return Posición del byte o npos.
+ */
+std::size_t findAnyOf(std::string_view text, std::string_view set, std::size_t pos = 0);
+
+/// Cuenta cuántas veces aparece el byte c en text.
+std::size_t countByte(std::string_view text, char c);
+
+/**
+ * @brief Parte text por delim y añade las piezas a out (sin vaciarlo antes).
+ *
+ * Las piezas son vistas sobre text: siguen siendo válidas mientras lo sea
+ * el buffer original. Dos delimitadores seguidos producen una pieza vacía,
+ * igual que un bucle con std::string_view::find.
+ */
+void split(std::string_view text, char delim, std::vector<std::string_view>& out);
+
+/// Versión cómoda de split que devuelve un vector nuevo.
+std::vector<std::string_view> split(std::string_view text, char delim);
+
+} // namespace sv_algo
+
+#endif // SV_ALGORITHMS_H
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "string_sort.h"
+
+// ----------------------------
+// Benchmark: string_sort::sort frente a std::sort
+// ----------------------------
+// Se ordenan N vistas sobre nombres del estilo "Apellido, Nombre 123456",
+// con muchos prefijos comunes (el peor caso para comparar cadena a cadena).
+
+namespace {
+
+template <typename F>
+double measureMs(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 10'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    const char* surnames[] = {"García", "Fernández", "González", "Rodríguez", "López", "Martínez", "Sánchez", "Pérez"};
+    const char* names[] = {"Alex", "John", "María José", "Ana", "Peach", "Alexander"};
+    std::mt19937 rng{13};
+
+    // Todas las cadenas en un único buffer, como si vinieran de un fichero.
+    std::string buffer{};
+    std::vector<std::pair<std::size_t, std::size_t>> ranges(count);
+    for (auto& range : ranges) {
+        const std::size_t begin = buffer.size();
+        buffer += surnames[rng() % 8];
+        buffer += ", ";
+        buffer += names[rng() % 6];
+        buffer += ' ';
+        buffer += std::to_string(rng() % 1'000'000);
+        range = {begin, buffer.size() - begin};
+    }
+    std::vector<std::string_view> input(count);
+    for (std::size_t i = 0; i < count; ++i) input[i] = std::string_view{buffer}.substr(ranges[i].first, ranges[i].second);
+
+    std::cout << "Ordenar " << count << " std::string_view\n";
+
+    std::vector<std::string_view> expected{input};
+    const double stdMs = measureMs([&] { std::sort(expected.begin(), expected.end()); });
+    std::cout << "  std::sort                      " << std::fixed << std::setprecision(1) << std::setw(10) << stdMs << " ms\n";
+
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads : {1u, cores}) {
+        std::vector<std::string_view> work{input};
+        string_sort::Options options{};
+        options.threads = threads;
+        const double ms = measureMs([&] { string_sort::sort(work, options); });
+        std::cout << "  string_sort (" << std::setw(2) << threads << " hilo/s)          " << std::setw(10) << ms << " ms"
+                  << (work == expected ? "" : "  ¡ORDEN DISTINTO!") << '\n';
+        if (cores == 1) break;
+    }
+
+    return 0;
+}
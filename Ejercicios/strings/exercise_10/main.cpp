@@ -0,0 +1,20 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "string_sort.h"
+
+int main() {
+    // Los std::string son los propietarios; se ordenan solo las vistas.
+    std::vector<std::string> owners{"World", "Hello", "Alex", "Al", "John", "Peach", "snowball", "Alexander", ""};
+    std::vector<std::string_view> views(owners.begin(), owners.end());
+
+    string_sort::sort(views);
+
+    for (std::string_view view : views) std::cout << '"' << view << "\" ";
+    std::cout << '\n';
+
+    // Los bytes no se han movido: owners sigue en su orden original.
+    std::cout << "owners[0] sigue siendo: " << owners[0] << '\n';
+    return 0;
+}
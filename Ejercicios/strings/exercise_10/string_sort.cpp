@@ -0,0 +1,216 @@
+#include "string_sort.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace string_sort {
+
+namespace {
+
+using Iterator = std::vector<std::string_view>::iterator;
+
+constexpr std::size_t bucketCount = 257; // 0 = fin de cadena, 1..256 = byte + 1
+constexpr std::size_t insertionThreshold = 16;
+constexpr std::size_t maxRadixLevels = 32;
+
+// Clave de la vista en la posición depth. El fin de cadena (0) va antes que
+// cualquier byte, así "Al" queda antes que "Alex".
+int keyAt(std::string_view view, std::size_t depth) {
+    return depth < view.size() ? static_cast<unsigned char>(view[depth]) + 1 : 0;
+}
+
+// ----------------------------
+// Casos pequeños
+// ----------------------------
+// Todas las vistas del rango comparten los depth primeros bytes: solo se
+// compara desde ahí.
+void insertionSort(Iterator first, Iterator last, std::size_t depth) {
+    for (Iterator i = first + 1; i < last; ++i) {
+        const std::string_view value = *i;
+        const std::string_view suffix = value.substr(std::min(depth, value.size()));
+        Iterator j = i;
+        while (j > first && suffix < (j - 1)->substr(std::min(depth, (j - 1)->size()))) {
+            *j = *(j - 1);
+            --j;
+        }
+        *j = value;
+    }
+}
+
+// Multikey quicksort (Bentley y Sedgewick): partición en tres según el byte
+// en depth; solo la parte "igual" avanza al siguiente byte.
+void multikeyQuicksort(Iterator first, Iterator last, std::size_t depth) {
+    while (last - first > static_cast<std::ptrdiff_t>(insertionThreshold)) {
+        // Pivote: mediana de tres.
+        const Iterator middle = first + (last - first) / 2;
+        int a = keyAt(*first, depth);
+        int b = keyAt(*middle, depth);
+        int c = keyAt(*(last - 1), depth);
+        const int pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+        // Partición de Dijkstra: [first, lt) < pivot, [lt, i) == pivot, [gt, last) > pivot
+        Iterator lt = first;
+        Iterator i = first;
+        Iterator gt = last;
+        while (i < gt) {
+            const int key = keyAt(*i, depth);
+            if (key < pivot) {
+                std::iter_swap(lt++, i++);
+            } else if (key > pivot) {
+                std::iter_swap(i, --gt);
+            } else {
+                ++i;
+            }
+        }
+
+        multikeyQuicksort(first, lt, depth);
+        multikeyQuicksort(gt, last, depth);
+
+        // La parte igual sigue en el bucle (recursión de cola) con el siguiente byte,
+        // salvo que el pivote fuera fin de cadena: entonces son todas iguales.
+        if (pivot == 0) return;
+        first = lt;
+        last = gt;
+        ++depth;
+    }
+    insertionSort(first, last, depth);
+}
+
+// ----------------------------
+// Radix sort MSD
+// ----------------------------
+// Reparto "American flag": permuta las vistas en el sitio siguiendo ciclos.
+// La clave de cada vista se lee una sola vez y se guarda en keys (leerla
+// implica saltar a los bytes de la cadena, que es lo caro); keys se permuta
+// junto con las vistas. Devuelve el inicio de cada cubo (bucketCount + 1 entradas).
+std::array<std::size_t, bucketCount + 1> distribute(Iterator first, Iterator last, std::size_t depth,
+                                                    std::vector<std::uint16_t>& keys) {
+    const auto size = static_cast<std::size_t>(last - first);
+    keys.resize(size);
+    std::array<std::size_t, bucketCount + 1> starts{};
+    for (std::size_t i = 0; i < size; ++i) {
+        keys[i] = static_cast<std::uint16_t>(keyAt(first[static_cast<std::ptrdiff_t>(i)], depth));
+        ++starts[keys[i] + 1u];
+    }
+    for (std::size_t b = 0; b < bucketCount; ++b) starts[b + 1] += starts[b];
+
+    std::array<std::size_t, bucketCount> next{};
+    std::copy(starts.begin(), starts.end() - 1, next.begin());
+
+    for (std::size_t b = 0; b < bucketCount; ++b) {
+        while (next[b] < starts[b + 1]) {
+            std::string_view value = first[static_cast<std::ptrdiff_t>(next[b])];
+            std::uint16_t key = keys[next[b]];
+            while (key != b) {
+                const std::size_t target = next[key]++;
+                std::swap(value, first[static_cast<std::ptrdiff_t>(target)]);
+                std::swap(key, keys[target]);
+            }
+            keys[next[b]] = key;
+            first[static_cast<std::ptrdiff_t>(next[b]++)] = value;
+        }
+    }
+    return starts;
+}
+
+// Longitud del prefijo común a todas las vistas a partir de depth. Cada vista
+// se compara con la primera solo hasta el prefijo común encontrado hasta ahí.
+std::size_t commonPrefix(Iterator first, Iterator last, std::size_t depth) {
+    const std::string_view head = first->substr(std::min(depth, first->size()));
+    std::size_t common = head.size();
+    for (Iterator i = first + 1; i < last && common > 0; ++i) {
+        const std::string_view tail = i->substr(std::min(depth, i->size()));
+        const std::size_t limit = std::min(common, tail.size());
+        std::size_t k = 0;
+        while (k < limit && head[k] == tail[k]) ++k;
+        common = k;
+    }
+    return common;
+}
+
+// level cuenta los repartos anidados: cada uno deja en la pila el array de
+// inicios de cubo (~2 KB). Pasado maxRadixLevels se sigue con multikey
+// quicksort, que avanza por los bytes comunes sin recursión.
+void msdSort(Iterator first, Iterator last, std::size_t depth, std::size_t threshold,
+             std::vector<std::uint16_t>& keys, std::size_t level = 0) {
+    for (;;) {
+        const auto size = static_cast<std::size_t>(last - first);
+        if (size < threshold || level >= maxRadixLevels) {
+            multikeyQuicksort(first, last, depth);
+            return;
+        }
+
+        const auto starts = distribute(first, last, depth, keys);
+        std::size_t only = bucketCount;
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            if (starts[b + 1] - starts[b] == size) only = b;
+        }
+        if (only == bucketCount) {
+            // El cubo 0 son cadenas que terminan aquí: todas iguales, ya ordenadas.
+            for (std::size_t b = 1; b < bucketCount; ++b) {
+                if (starts[b + 1] - starts[b] > 1) {
+                    msdSort(first + static_cast<std::ptrdiff_t>(starts[b]),
+                            first + static_cast<std::ptrdiff_t>(starts[b + 1]), depth + 1, threshold, keys,
+                            level + 1);
+                }
+            }
+            return;
+        }
+        if (only == 0) return;
+
+        // Todas comparten el byte en depth: se salta de una vez el prefijo común
+        // en lugar de repartir byte a byte, y sin abrir otro nivel de recursión.
+        depth += 1 + commonPrefix(first, last, depth + 1);
+        if (std::all_of(first, last, [depth](std::string_view view) { return view.size() == depth; })) {
+            return; // todas las cadenas son iguales
+        }
+    }
+}
+
+} // namespace
+
+void sort(std::vector<std::string_view>& views, const Options& options) {
+    const std::size_t threshold = std::max<std::size_t>(options.quicksortThreshold, 2);
+    unsigned threads = options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+    if (threads <= 1 || views.size() < threshold * 64) {
+        std::vector<std::uint16_t> keys{};
+        msdSort(views.begin(), views.end(), 0, threshold, keys);
+        return;
+    }
+
+    // Nivel superior en paralelo: un reparto secuencial por el primer byte y
+    // después los hilos se van quedando con cubos, del más grande al más pequeño.
+    std::vector<std::uint16_t> topKeys{};
+    const auto starts = distribute(views.begin(), views.end(), 0, topKeys);
+    topKeys = {};
+    std::vector<std::size_t> order{};
+    for (std::size_t b = 1; b < bucketCount; ++b) {
+        if (starts[b + 1] - starts[b] > 1) order.push_back(b);
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) {
+        return starts[x + 1] - starts[x] > starts[y + 1] - starts[y];
+    });
+
+    std::atomic<std::size_t> nextBucket{0};
+    auto worker = [&] {
+        std::vector<std::uint16_t> keys{}; // cada hilo con su propio buffer de claves
+        for (std::size_t i = nextBucket++; i < order.size(); i = nextBucket++) {
+            const std::size_t b = order[i];
+            msdSort(views.begin() + static_cast<std::ptrdiff_t>(starts[b]),
+                    views.begin() + static_cast<std::ptrdiff_t>(starts[b + 1]), 1, threshold, keys);
+        }
+    };
+
+    threads = std::min<unsigned>(threads, static_cast<unsigned>(order.size()));
+    std::vector<std::thread> pool{};
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (std::thread& thread : pool) thread.join();
+}
+
+} // namespace string_sort
@@ -0,0 +1,38 @@
+#ifndef STRING_SORT_H
+#define STRING_SORT_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Ordenación de grandes colecciones de std::string_view.
+ *
+ * Radix sort MSD (por el byte más significativo primero): se reparten las
+ * vistas en 256 cubos según el byte en la posición depth y se ordena cada cubo
+ * recursivamente con depth + 1. Los cubos pequeños pasan a quicksort de tres
+ * vías por clave (multikey quicksort), más rápido con pocos elementos.
+ * Un cubo con todas las vistas salta su prefijo común sin recursión, y pasados
+ * unos niveles de reparto se sigue con multikey quicksort, así la pila no
+ * crece con la longitud de los prefijos comunes.
+ *
+ * Solo se reordenan las vistas: los bytes de las cadenas nunca se copian.
+ * El resultado es el mismo orden que std::sort con el comparador por defecto
+ * de std::string_view (orden de bytes sin signo; un prefijo va antes).
+ */
+namespace string_sort {
+
+/// Opciones de ordenación.
+struct Options {
+    /// Por debajo de este tamaño un cubo se ordena con multikey quicksort.
+    std::size_t quicksortThreshold = 64;
+    /// Hilos para el primer nivel (0 = std::thread::hardware_concurrency()).
+    unsigned threads = 1;
+};
+
+/// Ordena views en el sitio.
+void sort(std::vector<std::string_view>& views, const Options& options = Options{});
+
+} // namespace string_sort
+
+#endif // STRING_SORT_H
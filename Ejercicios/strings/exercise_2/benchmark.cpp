@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "line_reader.h"
+
+// ----------------------------
+// Benchmark: líneas por segundo
+// ----------------------------
+// Genera un fichero temporal con nombres (con espacios iniciales y alguna
+// línea vacía, para que std::ws tenga trabajo) y lo lee de tres formas:
+// getline + std::ws, LineReader por bloques y LineReader con mmap.
+
+namespace {
+
+struct Result {
+    std::size_t lines{};
+    std::size_t bytes{}; // suma de longitudes, para comprobar que todos leen lo mismo
+};
+
+template <typename F>
+void run(std::string_view name, F&& readAll) {
+    const auto start = std::chrono::steady_clock::now();
+    const Result result = readAll();
+    const auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << std::left << std::setw(26) << name << std::right
+              << std::setw(12) << result.lines
+              << std::setw(14) << result.bytes
+              << std::setw(14) << std::fixed << std::setprecision(1) << result.lines / seconds / 1e6 << " M líneas/s\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t lineCount = 5'000'000;
+    if (argc > 1) lineCount = std::strtoull(argv[1], nullptr, 10);
+
+    const std::string path = "line_reader_bench.txt";
+    {
+        const char* names[] = {"Alex", "John Smith", "María José García", "Peach", "Hello World", "Ana"};
+        std::mt19937 rng{7};
+        std::ofstream out{path, std::ios::binary};
+        for (std::size_t i = 0; i < lineCount; ++i) {
+            if (rng() % 16 == 0) out << '\n';           // línea vacía
+            out << std::string(rng() % 3, ' ')            // espacios iniciales
+                << names[rng() % 6] << ' ' << i << '\n';
+        }
+    }
+
+    std::cout << std::left << std::setw(26) << "método" << std::right << std::setw(12) << "líneas"
+              << std::setw(14) << "bytes" << std::setw(14) << "velocidad" << '\n';
+
+    run("getline(in >> std::ws)", [&] {
+        std::ifstream in{path};
+        Result result{};
+        std::string fullName{};
+        while (std::getline(in >> std::ws, fullName)) {
+            ++result.lines;
+            result.bytes += fullName.size();
+        }
+        return result;
+    });
+
+    run("LineReader (bloques)", [&] {
+        LineReader reader{path, LineReader::Mode::Buffered};
+        Result result{};
+        std::string_view fullName{};
+        while (reader.next(fullName)) {
+            ++result.lines;
+            result.bytes += fullName.size();
+        }
+        return result;
+    });
+
+    run("LineReader (mmap)", [&] {
+        LineReader reader{path, LineReader::Mode::Mapped};
+        Result result{};
+        std::string_view fullName{};
+        while (reader.next(fullName)) {
+            ++result.lines;
+            result.bytes += fullName.size();
+        }
+        return result;
+    });
+
+    std::remove(path.c_str());
+    return 0;
+}
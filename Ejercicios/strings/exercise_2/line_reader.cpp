@@ -0,0 +1,150 @@
+#include "line_reader.h"
+
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LINE_READER_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Mismos caracteres que salta std::ws en la locale "C".
+bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+} // namespace
+
+LineReader::LineReader(std::FILE* file, std::size_t blockSize)
+    : file_(file), open_(file != nullptr), buffer_(blockSize > 0 ? blockSize : defaultBlockSize) { }
+
+LineReader::LineReader(const std::string& path, Mode mode, std::size_t blockSize) {
+    buffer_.resize(blockSize > 0 ? blockSize : defaultBlockSize);
+    ownsFile_ = true;
+
+#ifdef LINE_READER_HAS_MMAP
+    if (mode == Mode::Mapped) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            if (mapFile(fd)) {
+                ::close(fd); // la proyección sigue siendo válida sin el descriptor
+                mode_ = Mode::Mapped;
+                open_ = true;
+                eof_ = true; // todo el fichero está ya "leído"
+                return;
+            }
+            // Una FIFO o /dev/stdin no se pueden proyectar (st_size es 0):
+            // se leen por bloques con el mismo descriptor, sin volver a abrirlas.
+            file_ = fdopen(fd, "rb");
+            if (file_ == nullptr) ::close(fd);
+            open_ = file_ != nullptr;
+            return;
+        }
+    }
+#else
+    (void)mode;
+#endif
+
+    // Modo Buffered, o Mapped sin soporte de mmap en este sistema.
+    file_ = std::fopen(path.c_str(), "rb");
+    open_ = file_ != nullptr;
+}
+
+LineReader::~LineReader() {
+#ifdef LINE_READER_HAS_MMAP
+    if (mapped_ != nullptr) munmap(const_cast<char*>(mapped_), mappedSize_);
+#endif
+    if (ownsFile_ && file_ != nullptr) std::fclose(file_);
+}
+
+bool LineReader::isOpen() const {
+    return open_;
+}
+
+LineReader::Mode LineReader::mode() const {
+    return mode_;
+}
+
+const char* LineReader::data() const {
+    return mode_ == Mode::Mapped ? mapped_ : buffer_.data();
+}
+
+// Solo los ficheros regulares: en cualquier otro st_size no es el tamaño de los datos.
+bool LineReader::mapFile(int fd) {
+#ifdef LINE_READER_HAS_MMAP
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) return false;
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    if (size > 0) {
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) return false;
+        madvise(address, size, MADV_SEQUENTIAL);
+        mapped_ = static_cast<const char*>(address);
+    }
+    mappedSize_ = size;
+    begin_ = 0;
+    end_ = mappedSize_;
+    return true;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+// Mueve los bytes pendientes al principio del buffer y lee otro bloque detrás.
+// Si una línea no cabe en el buffer, el buffer crece al doble.
+bool LineReader::refill() {
+    if (eof_ || file_ == nullptr) return false;
+
+    if (begin_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+    }
+    if (end_ == buffer_.size()) buffer_.resize(buffer_.size() * 2);
+
+    const std::size_t bytesRead = std::fread(buffer_.data() + end_, 1, buffer_.size() - end_, file_);
+    if (bytesRead == 0) {
+        eof_ = true;
+        return false;
+    }
+    end_ += bytesRead;
+    return true;
+}
+
+bool LineReader::next(std::string_view& line) {
+    // 1. Saltar espacios en blanco, como std::ws.
+    while (true) {
+        const char* bytes = data();
+        while (begin_ < end_ && isSpace(bytes[begin_])) ++begin_;
+        if (begin_ < end_) break;
+        if (!refill()) return false;
+    }
+
+    // 2. Buscar el final de la línea; si no está en el buffer, leer más.
+    std::size_t searchFrom = begin_;
+    while (true) {
+        const char* bytes = data();
+        const void* newline = std::memchr(bytes + searchFrom, '\n', end_ - searchFrom);
+        if (newline != nullptr) {
+            const std::size_t lineEnd = static_cast<std::size_t>(static_cast<const char*>(newline) - bytes);
+            line = std::string_view{bytes + begin_, lineEnd - begin_};
+            begin_ = lineEnd + 1;
+            return true;
+        }
+
+        // refill() desplaza los datos pendientes al inicio del buffer.
+        searchFrom = end_ - begin_;
+        if (!refill()) {
+            // Última línea sin '\n' final.
+            line = std::string_view{data() + begin_, end_ - begin_};
+            begin_ = end_;
+            return true;
+        }
+    }
+}
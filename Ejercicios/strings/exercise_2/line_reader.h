@@ -0,0 +1,94 @@
+#ifndef LINE_READER_H
+#define LINE_READER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class LineReader
+ * @brief Lee líneas de stdin o de un fichero sin crear un std::string por línea.
+ *
+ * Sustituye al bucle std::getline(std::cin >> std::ws, linea): antes de cada
+ * línea se saltan los espacios en blanco (incluidas las líneas vacías), igual
+ * que hace std::ws, y después se devuelve todo hasta el '\n' (sin incluirlo).
+ *
+ * Ventana de validez de las vistas devueltas por next():
+ * - Modo Buffered: la vista es válida hasta la siguiente llamada a next()
+ *   o hasta que se destruya el lector. El buffer interno se reutiliza.
+ * - Modo Mapped: la vista es válida mientras viva el lector, porque apunta
+ *   directamente al fichero proyectado en memoria.
+ */
+class LineReader {
+public:
+    /// Forma de obtener los datos.
+    enum class Mode {
+        Buffered, ///< Lecturas por bloques grandes con std::fread.
+        Mapped    ///< mmap del fichero completo (si no se puede proyectar, como una FIFO, Buffered).
+    };
+
+    /// Tamaño de bloque por defecto para el modo Buffered.
+    static constexpr std::size_t defaultBlockSize = std::size_t{1} << 20;
+
+    /**
+     * @brief Lector sobre un FILE* ya abierto (por ejemplo stdin).
+     * @param file Fichero del que leer. El lector no lo cierra.
+     * @param blockSize Tamaño de cada lectura.
+     */
+    explicit LineReader(std::FILE* file, std::size_t blockSize = defaultBlockSize);
+
+    /**
+     * @brief Lector sobre un fichero en disco.
+     * @param path Ruta del fichero.
+     * @param mode Buffered o Mapped.
+     * @param blockSize Tamaño de cada lectura en modo Buffered.
+     *
+     * Si el fichero no se puede abrir, isOpen() devuelve false y next()
+     * no devuelve ninguna línea.
+     */
+    explicit LineReader(const std::string& path, Mode mode = Mode::Buffered,
+                        std::size_t blockSize = defaultBlockSize);
+
+    ~LineReader();
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    /// Indica si la fuente de datos se abrió correctamente.
+    bool isOpen() const;
+
+    /// Modo que se está usando realmente.
+    Mode mode() const;
+
+    /**
+     * @brief Obtiene la siguiente línea.
+     * @param line Recibe la vista de la línea (sin '\n').
+     * @return false cuando ya no quedan líneas.
+     */
+    bool next(std::string_view& line);
+
+private:
+    bool refill();
+    bool mapFile(int fd);
+    const char* data() const;
+
+    std::FILE* file_{nullptr};
+    bool ownsFile_{false};
+    bool open_{false};
+    bool eof_{false};
+    Mode mode_{Mode::Buffered};
+
+    // Bytes pendientes en data()[begin_, end_).
+    // Modo Buffered: data() es buffer_.
+    std::vector<char> buffer_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+
+    // Modo Mapped: data() es el fichero completo proyectado en mapped_.
+    const char* mapped_{nullptr};
+    std::size_t mappedSize_{0};
+};
+
+#endif // LINE_READER_H
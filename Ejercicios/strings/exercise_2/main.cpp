@@ -0,0 +1,39 @@
+#include <cstdio>
+#include <iostream>
+#include <string_view>
+#include "line_reader.h"
+
+// Uso:
+//   ./main < nombres.txt        (lee de stdin)
+//   ./main nombres.txt          (lee del fichero con mmap)
+int main(int argc, char* argv[]) {
+    std::ios::sync_with_stdio(false);
+
+    if (argc > 1) {
+        LineReader reader{argv[1], LineReader::Mode::Mapped};
+        if (!reader.isOpen()) {
+            std::cerr << "No se pudo abrir " << argv[1] << '\n';
+            return 1;
+        }
+        std::string_view fullName{};
+        while (reader.next(fullName)) {
+            std::cout << "Hello, " << fullName << "!\n";
+        }
+        return 0;
+    }
+
+    // Equivalente a repetir std::getline(std::cin >> std::ws, fullName),
+    // pero sin un std::string por línea.
+    LineReader reader{stdin};
+    std::string_view fullName{};
+    std::size_t lines{0};
+    while (reader.next(fullName)) {
+        // fullName solo es válido hasta la siguiente llamada a next():
+        // si hay que guardarlo, se copia a un std::string.
+        std::cout << "Hello, " << fullName << "!\n";
+        ++lines;
+    }
+    std::cout << "Líneas leídas: " << lines << '\n';
+
+    return 0;
+}
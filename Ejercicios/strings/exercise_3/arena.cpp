@@ -0,0 +1,43 @@
+#include "arena.h"
+
+// Los bloques se crean con new char[] y no con std::make_unique<char[]>,
+// que los rellenaría de ceros para nada: se van a sobrescribir enseguida.
+
+Arena::Arena(std::size_t chunkSize)
+    : chunkSize_(chunkSize > 0 ? chunkSize : defaultChunkSize) { }
+
+char* Arena::allocate(std::size_t size) {
+    if (size > remaining_) {
+        // Una reserva grande no debe desperdiciar el resto del bloque actual:
+        // se le da un bloque a medida y se sigue usando el actual.
+        if (size > chunkSize_ / 4) {
+            chunks_.push_back(std::unique_ptr<char[]>(new char[size]));
+            bytesReserved_ += size;
+            bytesUsed_ += size;
+            return chunks_.back().get();
+        }
+        chunks_.push_back(std::unique_ptr<char[]>(new char[chunkSize_]));
+        bytesReserved_ += chunkSize_;
+        current_ = chunks_.back().get();
+        remaining_ = chunkSize_;
+    }
+
+    char* result = current_;
+    current_ += size;
+    remaining_ -= size;
+    bytesUsed_ += size;
+    return result;
+}
+
+void Arena::release() {
+    chunks_.clear();
+    chunks_.shrink_to_fit();
+    current_ = nullptr;
+    remaining_ = 0;
+    bytesUsed_ = 0;
+    bytesReserved_ = 0;
+}
+
+ArenaStats Arena::stats() const {
+    return ArenaStats{chunks_.size(), bytesUsed_, bytesReserved_};
+}
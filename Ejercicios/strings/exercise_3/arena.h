@@ -0,0 +1,60 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Estadísticas de memoria de un Arena.
+ */
+struct ArenaStats {
+    std::size_t chunks{};        ///< Bloques reservados al sistema.
+    std::size_t bytesUsed{};     ///< Bytes entregados con allocate().
+    std::size_t bytesReserved{}; ///< Bytes reservados en total (usados + libres).
+};
+
+/**
+ * @class Arena
+ * @brief Reserva memoria "por empuje" (bump allocation) en bloques grandes.
+ *
+ * allocate() solo avanza un puntero dentro del bloque actual; cuando no cabe,
+ * se pide otro bloque. No se puede liberar una reserva suelta: toda la memoria
+ * se libera de golpe con release() o al destruir el Arena.
+ * Las direcciones devueltas no cambian nunca hasta ese momento.
+ */
+class Arena {
+public:
+    /// Tamaño por defecto de cada bloque.
+    static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+    explicit Arena(std::size_t chunkSize = defaultChunkSize);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) noexcept = default;
+    Arena& operator=(Arena&&) noexcept = default;
+
+    /**
+     * @brief Reserva size bytes sin alinear (pensado para caracteres).
+     *
+     * Las reservas mayores que el bloque reciben un bloque propio.
+     */
+    char* allocate(std::size_t size);
+
+    /// Libera todos los bloques. Invalida todo lo reservado.
+    void release();
+
+    /// Estadísticas de uso.
+    ArenaStats stats() const;
+
+private:
+    std::size_t chunkSize_;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char* current_{nullptr};
+    std::size_t remaining_{0};
+    std::size_t bytesUsed_{0};
+    std::size_t bytesReserved_{0};
+};
+
+#endif // ARENA_H
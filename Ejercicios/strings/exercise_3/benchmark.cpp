@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "string_interner.h"
+
+// ----------------------------
+// Benchmark: StringInterner frente a std::unordered_set<std::string>
+// ----------------------------
+// Se internan N nombres con muchas repeticiones (como una lista de personas)
+// y después se comparan por igualdad pares de nombres ya internados.
+
+namespace {
+
+volatile std::size_t sink{};
+
+template <typename F>
+double measureNs(std::size_t operations, F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operations);
+}
+
+void printRow(std::string_view name, double ns) {
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << ns << " ns/op\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 5'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    // ~100 000 nombres distintos repetidos al azar.
+    std::mt19937 rng{1};
+    std::vector<std::string> input(count);
+    for (std::string& name : input) name = "Name_" + std::to_string(rng() % 100'000);
+
+    // 1. Internar / insertar
+    StringInterner interner{};
+    std::vector<InternedString> handles(count);
+    printRow("StringInterner::intern", measureNs(count, [&] {
+        for (std::size_t i = 0; i < count; ++i) handles[i] = interner.intern(input[i]);
+    }));
+
+    std::unordered_set<std::string> set{};
+    std::vector<const std::string*> pointers(count);
+    printRow("unordered_set<std::string>::insert", measureNs(count, [&] {
+        for (std::size_t i = 0; i < count; ++i) pointers[i] = &*set.insert(input[i]).first;
+    }));
+
+    // 2. Comparar por igualdad
+    printRow("igualdad por id", measureNs(count, [&] {
+        std::size_t equal = 0;
+        for (std::size_t i = 1; i < count; ++i) equal += handles[i] == handles[i - 1];
+        sink = equal;
+    }));
+
+    printRow("igualdad std::string", measureNs(count, [&] {
+        std::size_t equal = 0;
+        for (std::size_t i = 1; i < count; ++i) equal += input[i] == input[i - 1];
+        sink = equal;
+    }));
+
+    // 3. Memoria
+    const ArenaStats stats{interner.arenaStats()};
+    std::cout << "\nCadenas distintas: " << interner.size() << '\n'
+              << "Arena: " << stats.bytesUsed << " bytes usados / " << stats.bytesReserved
+              << " reservados en " << stats.chunks << " bloques\n"
+              << "Índice (tabla hash + vistas): " << interner.indexBytes() << " bytes\n";
+
+    printRow("clear() (liberación en bloque)", measureNs(1, [&] { interner.clear(); }));
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "string_interner.h"
+
+int main() {
+    StringInterner names{};
+
+    /*
+     * En 8.1-std_view2.cpp getName devolvía std::string y había que copiar
+     * el resultado a tempName antes de crear una vista. Con el interner la
+     * vista apunta al Arena, que vive más que cualquier temporal.
+     */
+    auto getName = [&names]() -> std::string_view {
+        return names.intern(std::string{"Alex"}).view; // el std::string temporal muere aquí, la vista no
+    };
+    std::string_view safeName{getName()};
+    std::cout << "Safe name: " << safeName << '\n';
+
+    // firstAlphabetical puede devolver una vista aunque los argumentos sean temporales.
+    auto firstAlphabetical = [&names](std::string_view s1, std::string_view s2) -> std::string_view {
+        return names.intern((s1 < s2) ? s1 : s2).view;
+    };
+    std::string_view first{firstAlphabetical(std::string{"World"}, std::string{"Hello"})};
+    std::cout << "First alphabetical: " << first << '\n';
+
+    // Cadenas iguales -> mismo id y misma dirección: comparar es O(1).
+    InternedString a{names.intern("Alex")};
+    InternedString b{names.intern(std::string{"Al"} + "ex")};
+    std::cout << "Mismo id: " << std::boolalpha << (a == b)
+              << ", misma dirección: " << (a.view.data() == b.view.data()) << '\n';
+
+    ArenaStats stats{names.arenaStats()};
+    std::cout << "Cadenas distintas: " << names.size()
+              << ", bytes usados: " << stats.bytesUsed
+              << ", bytes reservados: " << stats.bytesReserved
+              << " en " << stats.chunks << " bloque(s)\n";
+
+    names.clear(); // libera todo de golpe: a partir de aquí safeName y first son dangling
+    std::cout << "Tras clear(): " << names.size() << " cadenas, "
+              << names.arenaStats().bytesReserved << " bytes reservados\n";
+
+    return 0;
+}
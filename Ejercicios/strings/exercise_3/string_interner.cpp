@@ -0,0 +1,99 @@
+#include "string_interner.h"
+
+#include <cstring>
+#include <functional>
+
+namespace {
+
+// std::hash procesa 8 bytes por paso; los 32 bits altos se guardan en el hueco
+// y los bajos eligen la posición inicial.
+std::uint64_t hashString(std::string_view text) {
+    return static_cast<std::uint64_t>(std::hash<std::string_view>{}(text));
+}
+
+constexpr std::size_t initialSlots = 64; // siempre potencia de 2
+
+} // namespace
+
+StringInterner::StringInterner(std::size_t chunkSize)
+    : arena_(chunkSize), slots_(initialSlots) { }
+
+// Sondeo lineal: devuelve el hueco que contiene text o el primer hueco vacío.
+std::size_t StringInterner::findSlot(std::string_view text, std::uint64_t hash) const {
+    const std::size_t mask = slots_.size() - 1;
+    const auto shortHash = static_cast<std::uint32_t>(hash >> 32);
+    std::size_t index = static_cast<std::size_t>(hash) & mask;
+    while (true) {
+        const Slot& slot = slots_[index];
+        if (slot.idPlusOne == 0) return index;
+        if (slot.hash == shortHash && strings_[slot.idPlusOne - 1] == text) return index;
+        index = (index + 1) & mask;
+    }
+}
+
+void StringInterner::grow() {
+    std::vector<Slot> old;
+    old.swap(slots_);
+    slots_.assign(old.size() * 2, Slot{});
+
+    const std::size_t mask = slots_.size() - 1;
+    for (const Slot& slot : old) {
+        if (slot.idPlusOne == 0) continue;
+        const std::uint64_t hash = hashString(strings_[slot.idPlusOne - 1]);
+        std::size_t index = static_cast<std::size_t>(hash) & mask;
+        while (slots_[index].idPlusOne != 0) index = (index + 1) & mask;
+        slots_[index] = slot;
+    }
+}
+
+InternedString StringInterner::intern(std::string_view text) {
+    const std::uint64_t hash = hashString(text);
+    std::size_t index = findSlot(text, hash);
+    if (slots_[index].idPlusOne != 0) {
+        const std::uint32_t id = slots_[index].idPlusOne - 1;
+        return InternedString{id, strings_[id]};
+    }
+
+    // Factor de carga máximo del 50 %.
+    if ((strings_.size() + 1) * 2 > slots_.size()) {
+        grow();
+        index = findSlot(text, hash);
+    }
+
+    char* storage = arena_.allocate(text.size());
+    if (!text.empty()) std::memcpy(storage, text.data(), text.size());
+
+    const auto id = static_cast<std::uint32_t>(strings_.size());
+    strings_.emplace_back(storage, text.size());
+    slots_[index] = Slot{id + 1, static_cast<std::uint32_t>(hash >> 32)};
+    return InternedString{id, strings_.back()};
+}
+
+bool StringInterner::lookup(std::string_view text, InternedString& result) const {
+    const Slot& slot = slots_[findSlot(text, hashString(text))];
+    if (slot.idPlusOne == 0) return false;
+    result = InternedString{slot.idPlusOne - 1, strings_[slot.idPlusOne - 1]};
+    return true;
+}
+
+std::string_view StringInterner::view(std::uint32_t id) const {
+    return strings_[id];
+}
+
+std::size_t StringInterner::size() const {
+    return strings_.size();
+}
+
+void StringInterner::clear() {
+    arena_.release();
+    strings_.clear();
+    slots_.assign(initialSlots, Slot{});
+}
+
+ArenaStats StringInterner::arenaStats() const {
+    return arena_.stats();
+}
+
+std::size_t StringInterner::indexBytes() const {
+    return strings_.capacity() * sizeof(std::string_view) + slots_.capacity() * sizeof(Slot);
+}
@@ -0,0 +1,85 @@
+#ifndef STRING_INTERNER_H
+#define STRING_INTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "arena.h"
+
+/**
+ * @brief Cadena internada: vista estable + identificador de 32 bits.
+ *
+ * Dos InternedString del mismo StringInterner son iguales si y solo si
+ * sus id son iguales, así que la comparación es O(1).
+ */
+struct InternedString {
+    std::uint32_t id{};
+    std::string_view view{};
+
+    friend bool operator==(InternedString a, InternedString b) { return a.id == b.id; }
+    friend bool operator!=(InternedString a, InternedString b) { return a.id != b.id; }
+};
+
+/**
+ * @class StringInterner
+ * @brief Guarda cada cadena distinta una sola vez en un Arena.
+ *
+ * Las vistas devueltas apuntan a memoria del Arena y siguen siendo válidas
+ * hasta clear() o hasta que se destruya el interner, aunque la cadena
+ * original fuera un temporal. Así funciones como getName() pueden devolver
+ * std::string_view sin riesgo de dangling y sin reservar memoria por llamada.
+ */
+class StringInterner {
+public:
+    explicit StringInterner(std::size_t chunkSize = Arena::defaultChunkSize);
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /**
+     * @brief Devuelve la cadena internada equivalente a text.
+     *
+     * Si ya existía se devuelve la misma (mismo id y misma dirección);
+     * si no, se copia una vez al Arena.
+     */
+    InternedString intern(std::string_view text);
+
+    /**
+     * @brief Busca text sin insertarla.
+     * @return true y la cadena en result si ya estaba internada.
+     */
+    bool lookup(std::string_view text, InternedString& result) const;
+
+    /// Vista de la cadena con identificador id (id < size()).
+    std::string_view view(std::uint32_t id) const;
+
+    /// Número de cadenas distintas.
+    std::size_t size() const;
+
+    /// Libera de golpe todas las cadenas. Invalida todas las vistas.
+    void clear();
+
+    /// Memoria del Arena de caracteres.
+    ArenaStats arenaStats() const;
+
+    /// Memoria de la tabla hash y del índice por id, en bytes.
+    std::size_t indexBytes() const;
+
+private:
+    // Cada hueco guarda el id + 1 (0 = vacío) y parte del hash, para
+    // descartar la mayoría de colisiones sin tocar los caracteres.
+    struct Slot {
+        std::uint32_t idPlusOne{};
+        std::uint32_t hash{};
+    };
+
+    std::size_t findSlot(std::string_view text, std::uint64_t hash) const;
+    void grow();
+
+    Arena arena_;
+    std::vector<std::string_view> strings_;
+    std::vector<Slot> slots_;
+};
+
+#endif // STRING_INTERNER_H
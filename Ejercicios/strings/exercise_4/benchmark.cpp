@@ -0,0 +1,99 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "string_builder.h"
+
+// ----------------------------
+// Benchmark: concat() frente a cadenas de operator+ y std::ostringstream
+// ----------------------------
+// Para 2..64 piezas se mide el tiempo por concatenación y el número de
+// reservas de memoria por concatenación (contando llamadas a operator new).
+
+namespace {
+std::size_t allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+volatile std::size_t sink{};
+
+// Piezas de longitud variada; varias superan el SSO de std::string.
+constexpr std::array<std::string_view, 8> words{
+    "Hello, ", "John Smith", "!", " Welcome to the string chapter", ", ", "Alex", " and ", "Peach"};
+
+template <typename F>
+void run(std::string_view method, std::size_t pieces, F&& build) {
+    constexpr std::size_t iterations = 200'000;
+
+    const std::size_t allocationsBefore = allocationCount;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) sink = build().size();
+    const auto stop = std::chrono::steady_clock::now();
+    const std::size_t allocations = allocationCount - allocationsBefore;
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+    std::cout << std::left << std::setw(16) << method << std::right << std::setw(8) << pieces
+              << std::setw(12) << std::fixed << std::setprecision(1) << ns
+              << std::setw(14) << std::setprecision(2) << static_cast<double>(allocations) / iterations << '\n';
+}
+
+// Las tres variantes se generan con un pack de índices para que cada una
+// sea literalmente una expresión de N piezas, igual que escrita a mano.
+template <std::size_t... I>
+void runAll(const std::array<std::string, sizeof...(I)>& pieces, std::index_sequence<I...>) {
+    constexpr std::size_t n = sizeof...(I);
+
+    run("operator+", n, [&] { return (std::string{} + ... + pieces[I]); });
+    run("ostringstream", n, [&] {
+        std::ostringstream out{};
+        (out << ... << pieces[I]);
+        return out.str();
+    });
+    run("concat", n, [&] { return string_builder::concat(pieces[I]...); });
+}
+
+template <std::size_t N>
+void runPieces() {
+    std::array<std::string, N> pieces{};
+    for (std::size_t i = 0; i < N; ++i) pieces[i] = std::string{words[i % words.size()]};
+    runAll(pieces, std::make_index_sequence<N>{});
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::left << std::setw(16) << "método" << std::right << std::setw(8) << "piezas"
+              << std::setw(12) << "ns/op" << std::setw(14) << "reservas/op" << '\n';
+
+    runPieces<2>();
+    runPieces<4>();
+    runPieces<8>();
+    runPieces<16>();
+    runPieces<32>();
+    runPieces<64>();
+
+    // El saludo de 7-std_string.cpp, con un entero de propina.
+    const std::string fullName{"John Smith"};
+    const int age{42};
+    run("greeting +", 4, [&] { return "Hello, " + fullName + "! Age: " + std::to_string(age); });
+    run("greeting concat", 4, [&] { return string_builder::concat("Hello, ", fullName, "! Age: ", age); });
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "string_builder.h"
+
+int main() {
+    std::string fullName{"John Smith"};
+    int age{42};
+
+    // Antes: "Hello, " + fullName + "!" -> un temporal por cada operator+.
+    // Ahora: se mide todo, se reserva una vez y se copia una vez.
+    std::string greeting{string_builder::concat("Hello, ", fullName, "!")};
+    std::cout << greeting << '\n';
+
+    // Se pueden mezclar literales, std::string, std::string_view, char y enteros.
+    std::string_view city{"Madrid"};
+    std::cout << string_builder::concat(fullName, " tiene ", age, " años y vive en ", city, '.') << '\n';
+
+    // En un bucle, appendAll reutiliza la capacidad del std::string.
+    std::string line{};
+    for (int i = 1; i <= 3; ++i) {
+        line.clear();
+        string_builder::appendAll(line, "Línea ", i, " de ", 3);
+        std::cout << line << '\n';
+    }
+
+    return 0;
+}
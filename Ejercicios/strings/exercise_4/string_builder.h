@@ -0,0 +1,96 @@
+#ifndef STRING_BUILDER_H
+#define STRING_BUILDER_H
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * Concatenación con una sola reserva de memoria.
+ *
+ * "Hello, " + fullName + "!" crea un std::string temporal por cada operator+
+ * y puede realocar al crecer. concat() hace dos pasadas sobre las piezas:
+ * 1. Suma sus longitudes.
+ * 2. Reserva una vez y copia cada pieza una vez.
+ *
+ * Acepta std::string, std::string_view, literales C, char y enteros.
+ * Al ser plantillas, todo vive en el header.
+ */
+
+namespace string_builder {
+
+namespace detail {
+
+// Un entero se convierte a texto en un buffer local antes de medir.
+// 20 dígitos + signo bastan para cualquier entero de 64 bits.
+struct IntegerText {
+    char digits[24];
+    std::size_t length;
+
+    std::string_view view() const { return {digits, length}; }
+};
+
+template <typename T>
+constexpr bool isInteger = std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>;
+
+template <typename T>
+IntegerText integerText(T value) {
+    IntegerText text{};
+    const auto result = std::to_chars(text.digits, text.digits + sizeof(text.digits), value);
+    text.length = static_cast<std::size_t>(result.ptr - text.digits);
+    return text;
+}
+
+inline std::string_view pieceView(std::string_view text) { return text; }
+inline std::string_view pieceView(const IntegerText& text) { return text.view(); }
+
+// Un char es un carácter, no un número; cualquier otra cosa debe convertirse
+// a std::string_view (std::string, literales, std::string_view).
+template <typename T>
+auto makePiece(const T& value) {
+    if constexpr (std::is_same_v<T, char>) {
+        return std::string_view{&value, 1};
+    } else if constexpr (isInteger<T>) {
+        return integerText(value);
+    } else {
+        return std::string_view{value};
+    }
+}
+
+template <typename... Pieces>
+void appendPieces(std::string& out, const Pieces&... pieces) {
+    const std::size_t total = (out.size() + ... + pieceView(pieces).size());
+    out.reserve(total);
+    (out.append(pieceView(pieces)), ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Añade todas las piezas al final de out con, como mucho, una reserva.
+ *
+ * Útil en bucles: reutilizando out no se reserva memoria en absoluto
+ * una vez que tiene capacidad suficiente.
+ */
+template <typename... Args>
+void appendAll(std::string& out, const Args&... args) {
+    detail::appendPieces(out, detail::makePiece(args)...);
+}
+
+/**
+ * @brief Concatena las piezas en un std::string nuevo con una sola reserva.
+ *
+ * Ejemplo: concat("Hello, ", fullName, "! Tienes ", age, " años")
+ */
+template <typename... Args>
+std::string concat(const Args&... args) {
+    std::string result{};
+    appendAll(result, args...);
+    return result;
+}
+
+} // namespace string_builder
+
+#endif // STRING_BUILDER_H
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "fixed_string.h"
+
+// ----------------------------
+// Benchmark: FixedString<N> frente a std::string en contenedores grandes
+// ----------------------------
+// Se construyen, copian, ordenan y comparan millones de nombres. Con
+// longitudes de 4 a 20 bytes, parte de los nombres supera el SSO de
+// std::string (15 caracteres en libstdc++) y necesita memoria dinámica.
+
+namespace {
+
+volatile std::size_t sink{};
+
+template <typename F>
+double measureMs(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename Name>
+void runSuite(std::string_view typeName, const std::vector<std::string>& input, bool print) {
+    // resize + clear deja la memoria del vector ya tocada: así se mide la
+    // construcción de los nombres y no los fallos de página del vector.
+    std::vector<Name> names(input.size());
+    names.clear();
+    const double construct = measureMs([&] {
+        for (const std::string& name : input) names.emplace_back(std::string_view{name});
+    });
+
+    std::vector<Name> copy{};
+    const double copyMs = measureMs([&] { copy = names; });
+
+    const double compare = measureMs([&] {
+        std::size_t equal = 0;
+        for (std::size_t i = 1; i < copy.size(); ++i) equal += copy[i] == copy[i - 1];
+        sink = equal;
+    });
+
+    const double sort = measureMs([&] { std::sort(copy.begin(), copy.end()); });
+
+    if (!print) return;
+    std::cout << std::left << std::setw(18) << typeName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << construct << std::setw(10) << copyMs
+              << std::setw(12) << compare << std::setw(10) << sort
+              << std::setw(14) << sizeof(Name) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 5'000'000;
+    if (argc > 1) count = std::strtoull(argv[1], nullptr, 10);
+
+    const char* firstNames[] = {"Alex", "John", "Peach", "María", "Alexander", "Christopher"};
+    std::mt19937 rng{3};
+    std::vector<std::string> input(count);
+    for (std::string& name : input) {
+        name = firstNames[rng() % 6];
+        name += '_';
+        name += std::to_string(rng() % 100'000'000); // hasta 20 bytes en total
+    }
+
+    std::cout << std::left << std::setw(18) << "tipo" << std::right
+              << std::setw(12) << "crear ms" << std::setw(10) << "copiar"
+              << std::setw(12) << "comparar" << std::setw(10) << "ordenar"
+              << std::setw(14) << "sizeof" << '\n';
+
+    // Cada suite se ejecuta dos veces y se muestra la segunda: la primera
+    // paga los fallos de página al tocar memoria nueva del proceso.
+    for (bool print : {false, true}) {
+        runSuite<std::string>("std::string", input, print);
+        runSuite<FixedString<23>>("FixedString<23>", input, print);
+        runSuite<FixedString<31>>("FixedString<31>", input, print);
+    }
+
+    return 0;
+}
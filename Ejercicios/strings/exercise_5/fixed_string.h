@@ -0,0 +1,108 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @class FixedString
+ * @brief Cadena de capacidad fija N con almacenamiento dentro del objeto.
+ *
+ * Nunca reserva memoria dinámica: copiar una FixedString es copiar
+ * sizeof(FixedString) bytes. Se convierte implícitamente a std::string_view,
+ * así que se puede pasar a cualquier función que reciba una vista.
+ *
+ * Si el contenido no cabe:
+ * - en tiempo de compilación, el constructor constexpr no compila;
+ * - en tiempo de ejecución, el constructor lanza std::length_error
+ *   (como std::string al superar max_size());
+ * - tryFrom() devuelve std::nullopt, para que quien llama pueda quedarse
+ *   con un std::string en ese caso sin usar excepciones.
+ *
+ * @tparam N Número máximo de caracteres (sin contar el '\0' final).
+ */
+template <std::size_t N>
+class FixedString {
+public:
+    /// Tipo más pequeño capaz de guardar la longitud.
+    using size_type = std::conditional_t<(N < 256), std::uint8_t,
+                      std::conditional_t<(N < 65536), std::uint16_t, std::size_t>>;
+
+    static constexpr std::size_t capacity = N;
+
+    constexpr FixedString() = default;
+
+    constexpr FixedString(std::string_view text) {
+        if (text.size() > N) throw std::length_error{"FixedString: el texto no cabe"};
+        assign(text);
+    }
+
+    constexpr FixedString(const char* text)
+        : FixedString(std::string_view{text}) { }
+
+    FixedString(const std::string& text)
+        : FixedString(std::string_view{text}) { }
+
+    /// Versión sin excepciones: std::nullopt si text no cabe.
+    static constexpr std::optional<FixedString> tryFrom(std::string_view text) {
+        if (!fits(text)) return std::nullopt;
+        FixedString result{};
+        result.assign(text);
+        return result;
+    }
+
+    /// Indica si text cabe en una FixedString<N>.
+    static constexpr bool fits(std::string_view text) { return text.size() <= N; }
+
+    constexpr std::size_t size() const { return size_; }
+    constexpr std::size_t length() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr const char* data() const { return data_; }
+    constexpr const char* c_str() const { return data_; }
+
+    constexpr char operator[](std::size_t index) const { return data_[index]; }
+
+    constexpr operator std::string_view() const { return std::string_view{data_, size_}; }
+    constexpr std::string_view view() const { return std::string_view{data_, size_}; }
+
+    /// Conversión explícita, igual que std::string_view -> std::string.
+    explicit operator std::string() const { return std::string{data_, size_}; }
+
+    friend constexpr bool operator==(const FixedString& a, const FixedString& b) { return a.view() == b.view(); }
+    friend constexpr bool operator!=(const FixedString& a, const FixedString& b) { return a.view() != b.view(); }
+    friend constexpr bool operator<(const FixedString& a, const FixedString& b) { return a.view() < b.view(); }
+    friend constexpr bool operator>(const FixedString& a, const FixedString& b) { return a.view() > b.view(); }
+    friend constexpr bool operator<=(const FixedString& a, const FixedString& b) { return a.view() <= b.view(); }
+    friend constexpr bool operator>=(const FixedString& a, const FixedString& b) { return a.view() >= b.view(); }
+
+    friend std::ostream& operator<<(std::ostream& out, const FixedString& text) { return out << text.view(); }
+
+private:
+    constexpr void assign(std::string_view text) {
+        for (std::size_t i = 0; i < text.size(); ++i) data_[i] = text[i];
+        data_[text.size()] = '\0';
+        size_ = static_cast<size_type>(text.size());
+    }
+
+    // Todo el buffer se inicializa a '\0': así la copia y la comparación
+    // de objetos no leen memoria sin inicializar y el tipo es usable en constexpr.
+    char data_[N + 1]{};
+    size_type size_{0};
+};
+
+/// Permite usar FixedString como clave de std::unordered_map / std::unordered_set.
+template <std::size_t N>
+struct std::hash<FixedString<N>> {
+    std::size_t operator()(const FixedString<N>& text) const noexcept {
+        return std::hash<std::string_view>{}(text.view());
+    }
+};
+
+#endif // FIXED_STRING_H
@@ -0,0 +1,41 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "fixed_string.h"
+
+int main() {
+    // constexpr: el nombre queda construido en tiempo de compilación.
+    constexpr FixedString<15> name{"Alex"};
+    static_assert(name.size() == 4);
+    static_assert(sizeof(name) == 17); // 16 bytes de datos + 1 de longitud, sin punteros
+
+    // constexpr FixedString<3> tooLong{"Alexander"}; // no compila: no cabe
+
+    // Conversión implícita a std::string_view: sirve como parámetro de printSV.
+    auto printSV = [](std::string_view str) {
+        std::cout << "printSV: " << str << '\n';
+    };
+    printSV(name);
+
+    FixedString<15> other{"John"};
+    std::cout << std::boolalpha << "name < other: " << (name < other) << '\n';
+
+    // Si el contenido no cabe, tryFrom permite quedarse con un std::string.
+    std::string input{"María José García Fernández"};
+    if (auto fixed = FixedString<15>::tryFrom(input)) {
+        std::cout << "Cabe en FixedString<15>: " << *fixed << '\n';
+    } else {
+        std::string fallback{input};
+        std::cout << "No cabe, se guarda en std::string: " << fallback << '\n';
+    }
+
+    // El constructor de tiempo de ejecución lanza std::length_error.
+    try {
+        FixedString<4> shortName{input};
+        std::cout << shortName << '\n';
+    } catch (const std::length_error& error) {
+        std::cout << "Error: " << error.what() << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "perfect_hash_map.h"
+
+// ----------------------------
+// Benchmark: PerfectHashMap frente a std::unordered_map y una cadena de if/else
+// ----------------------------
+// Las claves ("key0", "key1", ...) se generan en tiempo de compilación, así que
+// cada PerfectHashMap<int, N> se construye entero durante la compilación.
+// La cadena de if/else se representa con una búsqueda lineal, que es lo que
+// el compilador genera para una secuencia de comparaciones de cadenas.
+
+namespace {
+
+volatile std::size_t sink{};
+
+constexpr std::size_t keyLength = 12;
+
+template <std::size_t N>
+struct KeyText {
+    std::array<std::array<char, keyLength>, N> text{};
+    std::array<std::size_t, N> length{};
+};
+
+template <std::size_t N>
+constexpr KeyText<N> makeKeyText() {
+    KeyText<N> keys{};
+    for (std::size_t i = 0; i < N; ++i) {
+        char digits[8]{};
+        std::size_t count = 0;
+        std::size_t value = i;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        auto& text = keys.text[i];
+        text[0] = 'k';
+        text[1] = 'e';
+        text[2] = 'y';
+        for (std::size_t d = 0; d < count; ++d) text[3 + d] = digits[count - 1 - d];
+        keys.length[i] = 3 + count;
+    }
+    return keys;
+}
+
+template <std::size_t N>
+inline constexpr KeyText<N> keyText = makeKeyText<N>();
+
+template <std::size_t N>
+constexpr std::string_view key(std::size_t i) {
+    return std::string_view{keyText<N>.text[i].data(), keyText<N>.length[i]};
+}
+
+template <std::size_t N, std::size_t... I>
+constexpr std::array<std::pair<std::string_view, int>, N> makeEntries(std::index_sequence<I...>) {
+    return {{std::pair<std::string_view, int>{key<N>(I), static_cast<int>(I)}...}};
+}
+
+template <std::size_t N>
+inline constexpr auto entries = makeEntries<N>(std::make_index_sequence<N>{});
+
+template <std::size_t N>
+inline constexpr auto perfectMap = perfect_hash::makePerfectHashMap<int>(entries<N>);
+
+template <typename F>
+double measureNs(const std::vector<std::string>& queries, F&& lookup) {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t acc = 0;
+    for (const std::string& query : queries) acc += static_cast<std::size_t>(lookup(query));
+    const auto stop = std::chrono::steady_clock::now();
+    sink = acc;
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(queries.size());
+}
+
+template <std::size_t N>
+void run() {
+    // Consultas: 90 % claves existentes y 10 % desconocidas.
+    std::mt19937 rng{5};
+    std::vector<std::string> queries(1'000'000);
+    for (std::string& query : queries) {
+        query = (rng() % 10 == 0) ? "missing" + std::to_string(rng() % 1000) : std::string{key<N>(rng() % N)};
+    }
+
+    std::unordered_map<std::string_view, int> hashMap{};
+    for (const auto& [name, value] : entries<N>) hashMap.emplace(name, value);
+
+    // La búsqueda lineal es O(N) por consulta: con muchas claves se usan menos consultas.
+    const std::size_t linearQueries = std::max<std::size_t>(1000, queries.size() / N);
+    const std::vector<std::string> fewQueries(queries.begin(), queries.begin() + static_cast<std::ptrdiff_t>(linearQueries));
+
+    const double perfect = measureNs(queries, [](std::string_view query) {
+        return perfectMap<N>.valueOr(query, -1);
+    });
+    const double unordered = measureNs(queries, [&](std::string_view query) {
+        const auto it = hashMap.find(query);
+        return it != hashMap.end() ? it->second : -1;
+    });
+    const double chain = measureNs(fewQueries, [](std::string_view query) {
+        for (const auto& [name, value] : entries<N>) {
+            if (query == name) return value;
+        }
+        return -1;
+    });
+
+    std::cout << std::setw(8) << N << std::fixed << std::setprecision(2)
+              << std::setw(16) << perfect << std::setw(18) << unordered << std::setw(14) << chain << '\n';
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::setw(8) << "claves" << std::setw(16) << "perfecto ns" << std::setw(18) << "unordered_map ns"
+              << std::setw(14) << "if/else ns" << '\n';
+    run<4>();
+    run<16>();
+    run<64>();
+    run<256>();
+    run<1024>();
+    run<4096>();
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include <array>
+#include <iostream>
+#include <string_view>
+#include <utility>
+#include "perfect_hash_map.h"
+
+// Camino inverso de getBoolName: texto -> valor, resuelto en compilación.
+constexpr auto boolByName = perfect_hash::makePerfectHashMap<bool>(std::array<std::pair<std::string_view, bool>, 6>{{
+    {"true", true}, {"false", false}, {"yes", true}, {"no", false}, {"si", true}, {"on", true},
+}});
+
+enum class Color { red, green, blue };
+
+constexpr auto colorByName = perfect_hash::makePerfectHashMap<Color>(std::array<std::pair<std::string_view, Color>, 3>{{
+    {"red", Color::red}, {"green", Color::green}, {"blue", Color::blue},
+}});
+
+// Al ser constexpr, también se puede consultar en compilación.
+static_assert(*colorByName.find("green") == Color::green);
+static_assert(!colorByName.contains("purple"));
+
+int main() {
+    for (std::string_view text : {"true", "no", "si", "quizá"}) {
+        if (const bool* value = boolByName.find(text)) {
+            std::cout << text << " -> " << std::boolalpha << *value << '\n';
+        } else {
+            std::cout << text << " -> (desconocido)\n";
+        }
+    }
+
+    Color color{colorByName.valueOr("blue", Color::red)};
+    std::cout << "blue -> " << static_cast<int>(color) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#ifndef PERFECT_HASH_MAP_H
+#define PERFECT_HASH_MAP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+/*
+ * Tabla hash perfecta construida en tiempo de compilación.
+ *
+ * getBoolName (8.1-std_view2.cpp) traduce valor -> texto con literales.
+ * El camino inverso, texto -> valor, suele acabar en una cadena de if/else.
+ * PerfectHashMap calcula en compilación una tabla sin colisiones para una
+ * lista fija de claves, de forma que cada búsqueda cuesta:
+ *   un hash de la clave + un acceso a la tabla + una comparación.
+ *
+ * Construcción (esquema "hash and displace"):
+ * 1. Cada clave cae en un cubo según su hash.
+ * 2. Se recorren los cubos de mayor a menor. Para cada uno se busca un
+ *    desplazamiento d tal que todas sus claves, mezcladas con d, caen en
+ *    huecos libres de la tabla.
+ * 3. Se guarda d por cubo. Buscar = cubo -> d -> hueco -> comparar.
+ *
+ * Todo es constexpr: declarando el mapa como constexpr no hay ninguna
+ * inicialización en tiempo de ejecución. Si hay claves repetidas, la
+ * construcción lanza std::invalid_argument (error de compilación si es constexpr).
+ *
+ * Con miles de claves el evaluador constexpr de GCC puede quedarse sin
+ * operaciones; en ese caso se amplía con -fconstexpr-ops-limit=N.
+ */
+
+namespace perfect_hash {
+
+/// FNV-1a de 64 bits: se puede evaluar en tiempo de compilación.
+constexpr std::uint64_t hashKey(std::string_view key) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// Mezcla el hash con el desplazamiento de su cubo (finalizador de splitmix64).
+constexpr std::uint64_t mix(std::uint64_t hash, std::uint32_t displacement) {
+    std::uint64_t x = hash + 0x9E3779B97F4A7C15ull * (displacement + 1ull);
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/// Menor potencia de 2 >= n.
+constexpr std::size_t nextPowerOfTwo(std::size_t n) {
+    std::size_t power = 1;
+    while (power < n) power *= 2;
+    return power;
+}
+
+/**
+ * @class PerfectHashMap
+ * @brief Mapa de solo lectura std::string_view -> Value sin colisiones.
+ * @tparam Value Tipo de los valores (debe ser constexpr-construible por defecto).
+ * @tparam N Número de claves.
+ */
+template <typename Value, std::size_t N>
+class PerfectHashMap {
+public:
+    static constexpr std::size_t slotCount = nextPowerOfTwo(2 * N); // factor de carga <= 0.5
+    static constexpr std::size_t bucketCount = nextPowerOfTwo(N);
+    static constexpr std::size_t maxBucketSize = 32;
+
+    constexpr explicit PerfectHashMap(const std::array<std::pair<std::string_view, Value>, N>& entries) {
+        build(entries);
+    }
+
+    /// Puntero al valor de key, o nullptr si key no está en el mapa.
+    constexpr const Value* find(std::string_view key) const {
+        const std::uint64_t hash = hashKey(key);
+        const std::size_t slot = mix(hash, displacements_[bucketOf(hash)]) & (slotCount - 1);
+        return (used_[slot] && keys_[slot] == key) ? &values_[slot] : nullptr;
+    }
+
+    constexpr bool contains(std::string_view key) const { return find(key) != nullptr; }
+
+    /// Valor de key, o fallback si no está.
+    constexpr Value valueOr(std::string_view key, Value fallback) const {
+        const Value* value = find(key);
+        return value != nullptr ? *value : fallback;
+    }
+
+    static constexpr std::size_t size() { return N; }
+
+private:
+    // Los bits altos eligen el cubo; los bajos (tras mix) eligen el hueco.
+    static constexpr std::size_t bucketOf(std::uint64_t hash) {
+        return static_cast<std::size_t>(hash >> 40) & (bucketCount - 1);
+    }
+
+    constexpr void build(const std::array<std::pair<std::string_view, Value>, N>& entries) {
+        std::array<std::uint64_t, N> hashes{};
+        for (std::size_t i = 0; i < N; ++i) hashes[i] = hashKey(entries[i].first);
+
+        // Claves agrupadas por cubo (ordenación por recuento).
+        std::array<std::size_t, bucketCount + 1> bucketStart{};
+        for (std::size_t i = 0; i < N; ++i) ++bucketStart[bucketOf(hashes[i]) + 1];
+        std::size_t largestBucket = 0;
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            if (bucketStart[b + 1] > largestBucket) largestBucket = bucketStart[b + 1];
+            bucketStart[b + 1] += bucketStart[b];
+        }
+        if (largestBucket > maxBucketSize) throw std::invalid_argument{"PerfectHashMap: cubo demasiado grande"};
+        std::array<std::size_t, N> byBucket{};
+        std::array<std::size_t, bucketCount> fill{};
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::size_t b = bucketOf(hashes[i]);
+            byBucket[bucketStart[b] + fill[b]++] = i;
+        }
+
+        // Los cubos grandes primero: son los más difíciles de colocar.
+        std::array<std::size_t, maxBucketSize> slotsOfBucket{};
+        for (std::size_t size = largestBucket; size > 0; --size) {
+            for (std::size_t b = 0; b < bucketCount; ++b) {
+                if (bucketStart[b + 1] - bucketStart[b] != size) continue;
+
+                // Dos claves iguales caen siempre en el mismo cubo y en el mismo
+                // hueco: hay que detectarlas aquí o la búsqueda de d no acabaría.
+                for (std::size_t i = 0; i < size; ++i) {
+                    for (std::size_t j = i + 1; j < size; ++j) {
+                        if (entries[byBucket[bucketStart[b] + i]].first == entries[byBucket[bucketStart[b] + j]].first) {
+                            throw std::invalid_argument{"PerfectHashMap: clave repetida"};
+                        }
+                    }
+                }
+
+                for (std::uint32_t d = 0;; ++d) {
+                    bool fits = true;
+                    for (std::size_t k = 0; k < size && fits; ++k) {
+                        const std::size_t slot = mix(hashes[byBucket[bucketStart[b] + k]], d) & (slotCount - 1);
+                        fits = !used_[slot];
+                        for (std::size_t prev = 0; prev < k && fits; ++prev) fits = slotsOfBucket[prev] != slot;
+                        slotsOfBucket[k] = slot;
+                    }
+                    if (!fits) continue;
+
+                    displacements_[b] = d;
+                    for (std::size_t k = 0; k < size; ++k) {
+                        const std::size_t entry = byBucket[bucketStart[b] + k];
+                        used_[slotsOfBucket[k]] = true;
+                        keys_[slotsOfBucket[k]] = entries[entry].first;
+                        values_[slotsOfBucket[k]] = entries[entry].second;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    std::array<std::uint32_t, bucketCount> displacements_{};
+    std::array<bool, slotCount> used_{};
+    std::array<std::string_view, slotCount> keys_{};
+    std::array<Value, slotCount> values_{};
+};
+
+/// Deducción cómoda del tamaño: makePerfectHashMap<int>({{{"a", 1}, {"b", 2}}}).
+template <typename Value, std::size_t N>
+constexpr PerfectHashMap<Value, N> makePerfectHashMap(const std::array<std::pair<std::string_view, Value>, N>& entries) {
+    return PerfectHashMap<Value, N>{entries};
+}
+
+} // namespace perfect_hash
+
+#endif // PERFECT_HASH_MAP_H
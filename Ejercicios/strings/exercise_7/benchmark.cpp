@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "utf8.h"
+
+// ----------------------------
+// Benchmark: validación y recuento de puntos de código en GB/s
+// ----------------------------
+// Tres tipos de texto: ASCII puro, castellano (~5 % de letras con tilde) y
+// texto con muchos caracteres de 3 y 4 bytes. Cada uno se mide con el
+// kernel escalar y con el AVX2.
+
+namespace {
+
+volatile std::size_t sink{};
+
+std::string makeText(std::size_t bytes, int accentPercent, int wideCharPercent) {
+    const char* accents[] = {"á", "é", "í", "ó", "ú", "ñ", "Ñ", "ü"};
+    const char* wide[] = {"€", "中", "文", "😀", "👍"};
+    std::mt19937 rng{9};
+    std::string text{};
+    text.reserve(bytes + 4);
+    while (text.size() < bytes) {
+        const int roll = static_cast<int>(rng() % 100);
+        if (roll < wideCharPercent) {
+            text += wide[rng() % 5];
+        } else if (roll < wideCharPercent + accentPercent) {
+            text += accents[rng() % 8];
+        } else {
+            text += static_cast<char>(rng() % 7 == 0 ? ' ' : 'a' + rng() % 26);
+        }
+    }
+    return text;
+}
+
+template <typename F>
+double measureGBs(std::string_view text, F&& call) {
+    constexpr int repetitions = 10;
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t acc = 0;
+    for (int i = 0; i < repetitions; ++i) acc += call(text);
+    const auto stop = std::chrono::steady_clock::now();
+    sink = acc;
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    return static_cast<double>(text.size()) * repetitions / seconds / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t bytes = 64u << 20;
+    if (argc > 1) bytes = std::strtoull(argv[1], nullptr, 10);
+
+    struct Input {
+        const char* name;
+        std::string text;
+    };
+    const Input inputs[] = {
+        {"ASCII", makeText(bytes, 0, 0)},
+        {"castellano", makeText(bytes, 5, 0)},
+        {"multibyte", makeText(bytes, 20, 30)},
+    };
+
+    std::cout << std::left << std::setw(12) << "texto" << std::setw(10) << "kernel" << std::right
+              << std::setw(16) << "validar GB/s" << std::setw(16) << "contar GB/s" << '\n';
+
+    for (const Input& input : inputs) {
+        for (utf8::Kernel kernel : {utf8::Kernel::Scalar, utf8::Kernel::Avx2}) {
+            if (!utf8::forceKernel(kernel)) continue;
+            const double validate = measureGBs(input.text, [](std::string_view text) { return utf8::firstInvalid(text); });
+            const double count = measureGBs(input.text, [](std::string_view text) { return utf8::codePointCount(text); });
+            std::cout << std::left << std::setw(12) << input.name << std::setw(10) << utf8::kernelName(kernel)
+                      << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(16) << validate << std::setw(16) << count << '\n';
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "utf8.h"
+
+int main() {
+    std::cout << "Kernel en uso: " << utf8::kernelName(utf8::activeKernel()) << '\n';
+
+    // En 7-std_string.cpp: int nameLength = static_cast<int>(fullName.length());
+    // length() cuenta bytes; con tildes el resultado es incorrecto.
+    std::string fullName{"María José Núñez"};
+    int age{30};
+
+    int byteLength = static_cast<int>(fullName.length());
+    int nameLength = static_cast<int>(utf8::codePointCount(fullName));
+    std::cout << "length() en bytes: " << byteLength << ", caracteres: " << nameLength << '\n';
+    std::cout << "Your age + length of name is: " << age + nameLength << '\n';
+
+    // Validación: el byte suelto 0xFF no es UTF-8.
+    std::string broken{"Peach\xFF" "Alex"};
+    std::cout << std::boolalpha << "¿Válido? " << utf8::isValid(broken)
+              << ", prefijo válido: " << utf8::validPrefix(broken) << '\n';
+
+    // Recorte seguro: no parte la "é" (ni en forma "e" + tilde combinante).
+    std::string_view decomposed{"José Luis"}; // "José" escrito como e + U+0301
+    std::cout << "truncate(\"" << fullName << "\", 4): " << utf8::truncate(fullName, 4) << '\n';
+    std::cout << "truncate(\"" << decomposed << "\", 4): " << utf8::truncate(decomposed, 4) << '\n';
+
+    return 0;
+}
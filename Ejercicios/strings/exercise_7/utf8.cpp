@@ -0,0 +1,397 @@
+#include "utf8.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UTF8_X86 1
+#include <immintrin.h>
+#endif
+
+namespace utf8 {
+
+namespace {
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+
+// Longitud de la secuencia válida que empieza en text[i], o 0 si no es válida.
+// Sigue la tabla 3-7 del estándar Unicode (rangos de bytes bien formados).
+std::size_t sequenceLength(std::string_view text, std::size_t i) {
+    const auto byte = [&](std::size_t k) { return static_cast<unsigned char>(text[k]); };
+    const std::size_t remaining = text.size() - i;
+    const unsigned char lead = byte(i);
+
+    if (lead < 0x80) return 1;
+    if (lead < 0xC2) return 0; // continuación suelta o sobrelargo de 2 bytes
+    if (lead < 0xE0) {
+        return (remaining >= 2 && (byte(i + 1) & 0xC0) == 0x80) ? 2 : 0;
+    }
+    if (lead < 0xF0) {
+        if (remaining < 3) return 0;
+        const unsigned char second = byte(i + 1);
+        const unsigned char low = (lead == 0xE0) ? 0xA0 : 0x80; // sobrelargo de 3 bytes
+        const unsigned char high = (lead == 0xED) ? 0x9F : 0xBF; // surrogates U+D800..U+DFFF
+        if (second < low || second > high) return 0;
+        return ((byte(i + 2) & 0xC0) == 0x80) ? 3 : 0;
+    }
+    if (lead < 0xF5) {
+        if (remaining < 4) return 0;
+        const unsigned char second = byte(i + 1);
+        const unsigned char low = (lead == 0xF0) ? 0x90 : 0x80;  // sobrelargo de 4 bytes
+        const unsigned char high = (lead == 0xF4) ? 0x8F : 0xBF; // > U+10FFFF
+        if (second < low || second > high) return 0;
+        return ((byte(i + 2) & 0xC0) == 0x80 && (byte(i + 3) & 0xC0) == 0x80) ? 4 : 0;
+    }
+    return 0;
+}
+
+std::size_t firstInvalidScalar(std::string_view text, std::size_t from) {
+    std::size_t i = from;
+    while (i < text.size()) {
+        // Atajo ASCII: 8 bytes a la vez mientras ninguno tenga el bit alto.
+        if (i + 8 <= text.size()) {
+            std::uint64_t word{};
+            std::memcpy(&word, text.data() + i, 8);
+            if ((word & 0x8080808080808080ull) == 0) {
+                i += 8;
+                continue;
+            }
+        }
+
+        const std::size_t length = sequenceLength(text, i);
+        if (length == 0) return i;
+        i += length;
+    }
+    return text.size();
+}
+
+bool isContinuation(char c) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+std::size_t codePointCountScalar(std::string_view text) {
+    std::size_t count = 0;
+    for (char c : text) count += !isContinuation(c);
+    return count;
+}
+
+#ifdef UTF8_X86
+
+// ----------------------------
+// Kernel AVX2
+// ----------------------------
+// Validación "lookup" de Keiser y Lemire (Validating UTF-8 In Less Than One
+// Instruction Per Byte, 2021). Cada byte se clasifica junto con el anterior
+// mediante tres tablas de 16 entradas; el AND de las tres es distinto de
+// cero solo si el par de bytes es un error. Las secuencias de 3 y 4 bytes
+// se comprueban aparte mirando 2 y 3 bytes hacia atrás.
+
+constexpr std::uint8_t tooShort = 1 << 0;     // 11______ 0_______ / 11______ 11______
+constexpr std::uint8_t tooLong = 1 << 1;      // 0_______ 10______
+constexpr std::uint8_t overlong3 = 1 << 2;    // 11100000 100_____
+constexpr std::uint8_t tooLarge = 1 << 3;     // 11110100 1001____ ...
+constexpr std::uint8_t surrogate = 1 << 4;    // 11101101 101_____
+constexpr std::uint8_t overlong2 = 1 << 5;    // 1100000_ 10______
+constexpr std::uint8_t tooLarge1000 = 1 << 6; // 11110101 1000____ ...
+constexpr std::uint8_t overlong4 = 1 << 6;    // 11110000 1000____
+constexpr std::uint8_t twoConts = 1 << 7;     // 10______ 10______
+constexpr std::uint8_t carry = tooShort | tooLong | twoConts;
+
+__attribute__((target("avx2")))
+__m256i table16(std::uint8_t t0, std::uint8_t t1, std::uint8_t t2, std::uint8_t t3,
+                std::uint8_t t4, std::uint8_t t5, std::uint8_t t6, std::uint8_t t7,
+                std::uint8_t t8, std::uint8_t t9, std::uint8_t t10, std::uint8_t t11,
+                std::uint8_t t12, std::uint8_t t13, std::uint8_t t14, std::uint8_t t15) {
+    // La misma tabla en los dos carriles de 128 bits (pshufb trabaja por carril).
+    return _mm256_setr_epi8(
+        static_cast<char>(t0), static_cast<char>(t1), static_cast<char>(t2), static_cast<char>(t3),
+        static_cast<char>(t4), static_cast<char>(t5), static_cast<char>(t6), static_cast<char>(t7),
+        static_cast<char>(t8), static_cast<char>(t9), static_cast<char>(t10), static_cast<char>(t11),
+        static_cast<char>(t12), static_cast<char>(t13), static_cast<char>(t14), static_cast<char>(t15),
+        static_cast<char>(t0), static_cast<char>(t1), static_cast<char>(t2), static_cast<char>(t3),
+        static_cast<char>(t4), static_cast<char>(t5), static_cast<char>(t6), static_cast<char>(t7),
+        static_cast<char>(t8), static_cast<char>(t9), static_cast<char>(t10), static_cast<char>(t11),
+        static_cast<char>(t12), static_cast<char>(t13), static_cast<char>(t14), static_cast<char>(t15));
+}
+
+// Bytes del bloque anterior desplazados N posiciones (prev<N> en el artículo).
+template <int N>
+__attribute__((target("avx2"), always_inline)) inline
+__m256i previous(__m256i input, __m256i previousInput) {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previousInput, input, 0x21), 16 - N);
+}
+
+__attribute__((target("avx2"), always_inline)) inline
+__m256i highNibble(__m256i bytes) {
+    return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F));
+}
+
+struct Avx2Validator {
+    __m256i byte1High;
+    __m256i byte1Low;
+    __m256i byte2High;
+    __m256i incompleteLimit;
+    __m256i previousInput;
+    __m256i previousIncomplete;
+    __m256i error;
+
+    __attribute__((target("avx2")))
+    Avx2Validator() {
+        byte1High = table16(
+            tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+            twoConts, twoConts, twoConts, twoConts,
+            tooShort | overlong2,
+            tooShort,
+            tooShort | overlong3 | surrogate,
+            tooShort | tooLarge | tooLarge1000 | overlong4);
+        byte1Low = table16(
+            carry | overlong3 | overlong2 | overlong4,
+            carry | overlong2,
+            carry,
+            carry,
+            carry | tooLarge,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000 | surrogate,
+            carry | tooLarge | tooLarge1000,
+            carry | tooLarge | tooLarge1000);
+        byte2High = table16(
+            tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+            tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+            tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+            tooLong | overlong2 | twoConts | surrogate | tooLarge,
+            tooLong | overlong2 | twoConts | surrogate | tooLarge,
+            tooShort, tooShort, tooShort, tooShort);
+
+        // Un bloque termina "a medias" si alguno de sus 3 últimos bytes es
+        // un byte inicial cuya secuencia no cabe en el bloque.
+        alignas(32) std::uint8_t limits[32];
+        std::memset(limits, 0xFF, sizeof(limits));
+        limits[29] = 0xF0 - 1;
+        limits[30] = 0xE0 - 1;
+        limits[31] = 0xC0 - 1;
+        incompleteLimit = _mm256_load_si256(reinterpret_cast<const __m256i*>(limits));
+
+        previousInput = _mm256_setzero_si256();
+        previousIncomplete = _mm256_setzero_si256();
+        error = _mm256_setzero_si256();
+    }
+
+    __attribute__((target("avx2")))
+    void check(__m256i input) {
+        // Bloque ASCII: solo puede fallar si el anterior quedó a medias.
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, previousIncomplete);
+            previousInput = input;
+            previousIncomplete = _mm256_setzero_si256();
+            return;
+        }
+
+        const __m256i prev1 = previous<1>(input, previousInput);
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(_mm256_shuffle_epi8(byte1High, highNibble(prev1)),
+                             _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)))),
+            _mm256_shuffle_epi8(byte2High, highNibble(input)));
+
+        // Posiciones que deben ser la 2ª o 3ª continuación de una secuencia de 3/4 bytes.
+        const __m256i prev2 = previous<2>(input, previousInput);
+        const __m256i prev3 = previous<3>(input, previousInput);
+        const __m256i isThird = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+        const __m256i isFourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+        const __m256i must23 = _mm256_and_si256(_mm256_or_si256(isThird, isFourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+        error = _mm256_or_si256(error, _mm256_xor_si256(must23, special));
+        previousIncomplete = _mm256_subs_epu8(input, incompleteLimit);
+        previousInput = input;
+    }
+
+    __attribute__((target("avx2")))
+    bool failed() const {
+        return !_mm256_testz_si256(error, error);
+    }
+
+    // Al final del texto no puede quedar ninguna secuencia a medias.
+    __attribute__((target("avx2")))
+    bool failedAtEnd() const {
+        const __m256i all = _mm256_or_si256(error, previousIncomplete);
+        return !_mm256_testz_si256(all, all);
+    }
+};
+
+// Devuelve el inicio del primer bloque de 32 bytes con error, o npos si todo
+// es válido. El último bloque se rellena con ceros, que son ASCII.
+__attribute__((target("avx2")))
+std::size_t firstBadBlockAvx2(std::string_view text) {
+    Avx2Validator validator{};
+    const char* data = text.data();
+    std::size_t i = 0;
+    for (; i + 32 <= text.size(); i += 32) {
+        validator.check(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+        if (validator.failed()) return i;
+    }
+
+    alignas(32) char tail[32]{};
+    std::memcpy(tail, data + i, text.size() - i);
+    validator.check(_mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+    if (validator.failedAtEnd()) return i;
+    return std::string_view::npos;
+}
+
+std::size_t firstInvalidAvx2(std::string_view text) {
+    const std::size_t badBlock = firstBadBlockAvx2(text);
+    if (badBlock == std::string_view::npos) return text.size();
+
+    // El error puede venir de una secuencia que empezó hasta 3 bytes antes del
+    // bloque. Todo lo anterior era válido, así que basta con arrancar el
+    // validador escalar en el primer byte inicial de esos 3 últimos bytes.
+    std::size_t start = badBlock >= 3 ? badBlock - 3 : 0;
+    while (start < badBlock && isContinuation(text[start])) ++start;
+    return firstInvalidScalar(text, start);
+}
+
+__attribute__((target("avx2,popcnt")))
+std::size_t codePointCountAvx2(std::string_view text) {
+    // Un byte es el inicio de un punto de código si, como entero con signo,
+    // es mayor que -65 (0xBF): todo menos 10xxxxxx.
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    const char* data = text.data();
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= text.size(); i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto starts = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, threshold)));
+        count += static_cast<std::size_t>(__builtin_popcount(starts));
+    }
+    return count + codePointCountScalar(text.substr(i));
+}
+
+#endif // UTF8_X86
+
+struct Table {
+    std::size_t (*firstInvalid)(std::string_view);
+    std::size_t (*codePointCount)(std::string_view);
+};
+
+std::size_t firstInvalidScalarFromStart(std::string_view text) {
+    return firstInvalidScalar(text, 0);
+}
+
+constexpr Table scalarTable{firstInvalidScalarFromStart, codePointCountScalar};
+#ifdef UTF8_X86
+constexpr Table avx2Table{firstInvalidAvx2, codePointCountAvx2};
+#endif
+
+bool supports(Kernel kernel) {
+#ifdef UTF8_X86
+    if (kernel == Kernel::Avx2) return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+#endif
+    return kernel == Kernel::Scalar;
+}
+
+const Table& tableFor(Kernel kernel) {
+#ifdef UTF8_X86
+    if (kernel == Kernel::Avx2) return avx2Table;
+#endif
+    return scalarTable;
+}
+
+struct Dispatch {
+    Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state = [] {
+        const Kernel best = supports(Kernel::Avx2) ? Kernel::Avx2 : Kernel::Scalar;
+        return Dispatch{best, &tableFor(best)};
+    }();
+    return state;
+}
+
+// Decodifica el punto de código que empieza en text[i]. truncate no exige
+// texto válido: una secuencia cortada por el final da U+FFFD sin leer fuera.
+char32_t decodeAt(std::string_view text, std::size_t i) {
+    const auto byte = [&](std::size_t k) { return static_cast<char32_t>(static_cast<unsigned char>(text[k])); };
+    const char32_t lead = byte(i);
+    if (lead < 0x80) return lead;
+    const std::size_t length = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+    if (length > text.size() - i) return 0xFFFD;
+    if (lead < 0xE0) return ((lead & 0x1F) << 6) | (byte(i + 1) & 0x3F);
+    if (lead < 0xF0) return ((lead & 0x0F) << 12) | ((byte(i + 1) & 0x3F) << 6) | (byte(i + 2) & 0x3F);
+    return ((lead & 0x07) << 18) | ((byte(i + 1) & 0x3F) << 12) | ((byte(i + 2) & 0x3F) << 6) | (byte(i + 3) & 0x3F);
+}
+
+// Marcas que se pegan al carácter anterior y no deben quedar separadas de él.
+bool extendsPrevious(char32_t cp) {
+    return (cp >= 0x0300 && cp <= 0x036F)     // tildes y diacríticos combinantes
+        || (cp >= 0xFE00 && cp <= 0xFE0F)     // selectores de variación
+        || (cp >= 0x1F3FB && cp <= 0x1F3FF)   // tonos de piel
+        || cp == 0x200D;                      // zero width joiner
+}
+
+std::size_t previousStart(std::string_view text, std::size_t i) {
+    do {
+        --i;
+    } while (i > 0 && isContinuation(text[i]));
+    return i;
+}
+
+} // namespace
+
+Kernel activeKernel() {
+    return dispatch().kernel;
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    return kernel == Kernel::Avx2 ? "AVX2" : "escalar";
+}
+
+bool isValid(std::string_view text) {
+    return firstInvalid(text) == text.size();
+}
+
+std::size_t firstInvalid(std::string_view text) {
+    return dispatch().table->firstInvalid(text);
+}
+
+std::string_view validPrefix(std::string_view text) {
+    return text.substr(0, firstInvalid(text));
+}
+
+std::size_t codePointCount(std::string_view text) {
+    return dispatch().table->codePointCount(text);
+}
+
+std::string_view truncate(std::string_view text, std::size_t maxCodePoints) {
+    // 1. Byte donde empieza el punto de código número maxCodePoints.
+    std::size_t cut = 0;
+    for (std::size_t seen = 0; cut < text.size(); ++cut) {
+        if (!isContinuation(text[cut]) && seen++ == maxCodePoints) break;
+    }
+    if (cut >= text.size()) return text;
+
+    // 2. Si ahí empieza una marca combinante, o lo anterior es un ZWJ, el
+    //    carácter visible sigue: retrocedemos hasta dejarlo fuera entero.
+    while (cut > 0) {
+        const std::size_t before = previousStart(text, cut);
+        if (!extendsPrevious(decodeAt(text, cut)) && decodeAt(text, before) != 0x200D) break;
+        cut = before;
+    }
+    return text.substr(0, cut);
+}
+
+} // namespace utf8
@@ -0,0 +1,66 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Utilidades UTF-8 sobre std::string_view.
+ *
+ * std::string::length() cuenta bytes: "José" mide 5, no 4. Estas funciones
+ * trabajan con puntos de código (code points) y validan la codificación.
+ * Hay un kernel AVX2 (validación de Keiser y Lemire, 32 bytes por paso) y
+ * uno escalar; se elige el mejor en tiempo de ejecución.
+ */
+namespace utf8 {
+
+/// Implementaciones disponibles.
+enum class Kernel { Scalar, Avx2 };
+
+/// Kernel que se está usando.
+Kernel activeKernel();
+
+/// Fuerza un kernel. Devuelve false (sin cambiar nada) si la CPU no lo soporta.
+bool forceKernel(Kernel kernel);
+
+/// Nombre legible del kernel.
+const char* kernelName(Kernel kernel);
+
+/// Indica si text es UTF-8 válido (sin sobrelargos, sin surrogates, <= U+10FFFF).
+bool isValid(std::string_view text);
+
+/**
+ * @brief Posición del primer byte que rompe la codificación.
+ * @return text.size() si todo text es válido.
+ */
+std::size_t firstInvalid(std::string_view text);
+
+/// Prefijo válido más largo de text (una vista, sin copiar).
+std::string_view validPrefix(std::string_view text);
+
+/**
+ * @brief Número de puntos de código de un texto UTF-8 válido.
+ *
+ * Es la alternativa correcta a static_cast<int>(fullName.length()).
+ * Con texto inválido el resultado no tiene sentido: validar antes.
+ */
+std::size_t codePointCount(std::string_view text);
+
+/**
+ * @brief Recorta text a como mucho maxCodePoints puntos de código sin partir
+ *        caracteres visibles.
+ *
+ * Nunca corta en mitad de una secuencia UTF-8 y, si el corte cae justo antes
+ * de una marca que se combina con el carácter anterior (tildes combinantes
+ * U+0300..U+036F, selectores de variación, ZWJ, modificadores de tono de piel),
+ * retrocede hasta el carácter base. Es una aproximación de los grafemas de
+ * Unicode suficiente para nombres y texto en español; no cubre todas las reglas.
+ *
+ * Acepta texto inválido sin leer fuera de text: cada byte que no es de
+ * continuación cuenta como un punto de código.
+ */
+std::string_view truncate(std::string_view text, std::size_t maxCodePoints);
+
+} // namespace utf8
+
+#endif // UTF8_H
@@ -0,0 +1,225 @@
+#include "ascii_case.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ASCII_CASE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ascii_case {
+
+namespace {
+
+// ----------------------------
+// Kernel escalar
+// ----------------------------
+// (c - 'A') < 26 en unsigned es "c está entre 'A' y 'Z'" con una sola comparación.
+char lowerChar(char c) {
+    const auto byte = static_cast<unsigned char>(c);
+    return static_cast<char>(byte + (static_cast<unsigned char>(byte - 'A') < 26u ? 0x20 : 0));
+}
+
+char upperChar(char c) {
+    const auto byte = static_cast<unsigned char>(c);
+    return static_cast<char>(byte - (static_cast<unsigned char>(byte - 'a') < 26u ? 0x20 : 0));
+}
+
+void toLowerScalar(char* text, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) text[i] = lowerChar(text[i]);
+}
+
+void toUpperScalar(char* text, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) text[i] = upperChar(text[i]);
+}
+
+int compareScalar(std::string_view a, std::string_view b) {
+    const std::size_t common = std::min(a.size(), b.size());
+    for (std::size_t i = 0; i < common; ++i) {
+        const auto x = static_cast<unsigned char>(lowerChar(a[i]));
+        const auto y = static_cast<unsigned char>(lowerChar(b[i]));
+        if (x != y) return x < y ? -1 : 1;
+    }
+    if (a.size() == b.size()) return 0;
+    return a.size() < b.size() ? -1 : 1;
+}
+
+#ifdef ASCII_CASE_X86
+
+// ----------------------------
+// Kernel AVX2
+// ----------------------------
+// Las comparaciones de AVX2 son con signo; los bytes >= 0x80 quedan negativos
+// y por tanto fuera del rango 'A'..'Z', que es lo que queremos.
+__attribute__((target("avx2"), always_inline)) inline
+__m256i foldBlock(__m256i block, char first, char last) {
+    const __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8(static_cast<char>(first - 1))),
+                                             _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), block));
+    return _mm256_xor_si256(block, _mm256_and_si256(inRange, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+void foldAvx2(char* text, std::size_t size, char first, char last) {
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i* p = reinterpret_cast<__m256i*>(text + i);
+        _mm256_storeu_si256(p, foldBlock(_mm256_loadu_si256(p), first, last));
+    }
+    for (; i < size; ++i) {
+        if (text[i] >= first && text[i] <= last) text[i] = static_cast<char>(text[i] ^ 0x20);
+    }
+}
+
+void toLowerAvx2(char* text, std::size_t size) {
+    foldAvx2(text, size, 'A', 'Z');
+}
+
+void toUpperAvx2(char* text, std::size_t size) {
+    foldAvx2(text, size, 'a', 'z');
+}
+
+// Compara dos bloques de 32 bytes ya cargados; devuelve <0, 0 o >0.
+__attribute__((target("avx2"), always_inline)) inline
+int compareBlocks(__m256i x, __m256i y) {
+    const __m256i lowerX = foldBlock(x, 'A', 'Z');
+    const __m256i lowerY = foldBlock(y, 'A', 'Z');
+    const auto equal = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lowerX, lowerY)));
+    if (equal == 0xFFFFFFFFu) return 0;
+
+    alignas(32) unsigned char bytesX[32];
+    alignas(32) unsigned char bytesY[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(bytesX), lowerX);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(bytesY), lowerY);
+    const int index = __builtin_ctz(~equal);
+    return bytesX[index] < bytesY[index] ? -1 : 1;
+}
+
+__attribute__((target("avx2")))
+int compareAvx2(std::string_view a, std::string_view b) {
+    const std::size_t common = std::min(a.size(), b.size());
+    std::size_t i = 0;
+    for (; i + 32 <= common; i += 32) {
+        const int result = compareBlocks(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data() + i)),
+                                         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.data() + i)));
+        if (result != 0) return result;
+    }
+
+    // Cola: ambos restos tienen la misma longitud y se rellenan con ceros,
+    // así que el relleno nunca produce diferencias.
+    if (i < common) {
+        alignas(32) char tailA[32]{};
+        alignas(32) char tailB[32]{};
+        std::memcpy(tailA, a.data() + i, common - i);
+        std::memcpy(tailB, b.data() + i, common - i);
+        const int result = compareBlocks(_mm256_load_si256(reinterpret_cast<const __m256i*>(tailA)),
+                                         _mm256_load_si256(reinterpret_cast<const __m256i*>(tailB)));
+        if (result != 0) return result;
+    }
+
+    if (a.size() == b.size()) return 0;
+    return a.size() < b.size() ? -1 : 1;
+}
+
+#endif // ASCII_CASE_X86
+
+struct Table {
+    void (*toLower)(char*, std::size_t);
+    void (*toUpper)(char*, std::size_t);
+    int (*compare)(std::string_view, std::string_view);
+};
+
+constexpr Table scalarTable{toLowerScalar, toUpperScalar, compareScalar};
+#ifdef ASCII_CASE_X86
+constexpr Table avx2Table{toLowerAvx2, toUpperAvx2, compareAvx2};
+#endif
+
+bool supports(Kernel kernel) {
+#ifdef ASCII_CASE_X86
+    if (kernel == Kernel::Avx2) return __builtin_cpu_supports("avx2");
+#endif
+    return kernel == Kernel::Scalar;
+}
+
+const Table& tableFor(Kernel kernel) {
+#ifdef ASCII_CASE_X86
+    if (kernel == Kernel::Avx2) return avx2Table;
+#endif
+    return scalarTable;
+}
+
+struct Dispatch {
+    Kernel kernel;
+    const Table* table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch state = [] {
+        const Kernel best = supports(Kernel::Avx2) ? Kernel::Avx2 : Kernel::Scalar;
+        return Dispatch{best, &tableFor(best)};
+    }();
+    return state;
+}
+
+} // namespace
+
+Kernel activeKernel() {
+    return dispatch().kernel;
+}
+
+bool forceKernel(Kernel kernel) {
+    if (!supports(kernel)) return false;
+    dispatch() = Dispatch{kernel, &tableFor(kernel)};
+    return true;
+}
+
+const char* kernelName(Kernel kernel) {
+    return kernel == Kernel::Avx2 ? "AVX2" : "escalar";
+}
+
+void toLowerInPlace(char* text, std::size_t size) {
+    dispatch().table->toLower(text, size);
+}
+
+void toUpperInPlace(char* text, std::size_t size) {
+    dispatch().table->toUpper(text, size);
+}
+
+std::string toLower(std::string_view text) {
+    std::string result{text};
+    toLowerInPlace(result);
+    return result;
+}
+
+std::string toUpper(std::string_view text) {
+    std::string result{text};
+    toUpperInPlace(result);
+    return result;
+}
+
+int compareIgnoreCase(std::string_view a, std::string_view b) {
+    return dispatch().table->compare(a, b);
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && compareIgnoreCase(a, b) == 0;
+}
+
+// Se pliega el texto por trozos en un buffer local y se combina el hash de
+// cada trozo; el resultado es el mismo con cualquier kernel.
+std::size_t hashIgnoreCase(std::string_view text) {
+    constexpr std::size_t chunkSize = 64;
+    char chunk[chunkSize];
+    std::size_t hash = text.size();
+    for (std::size_t i = 0; i < text.size(); i += chunkSize) {
+        const std::size_t length = std::min(chunkSize, text.size() - i);
+        std::memcpy(chunk, text.data() + i, length);
+        toLowerInPlace(chunk, length);
+        const std::size_t chunkHash = std::hash<std::string_view>{}(std::string_view{chunk, length});
+        hash ^= chunkHash + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+} // namespace ascii_case
@@ -0,0 +1,69 @@
+#ifndef ASCII_CASE_H
+#define ASCII_CASE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Mayúsculas/minúsculas ASCII y comparación sin distinguir mayúsculas.
+ *
+ * Solo se pliegan las letras A-Z / a-z; el resto de bytes (incluidos los de
+ * UTF-8 como "Ñ") se dejan tal cual. Así "alex" y "Alex" quedan juntos al
+ * ordenar, sin depender de la locale. Hay kernel AVX2 (32 bytes por paso) y
+ * escalar, elegidos en tiempo de ejecución.
+ */
+namespace ascii_case {
+
+/// Implementaciones disponibles.
+enum class Kernel { Scalar, Avx2 };
+
+Kernel activeKernel();
+bool forceKernel(Kernel kernel);
+const char* kernelName(Kernel kernel);
+
+/// Convierte a minúsculas size bytes de text, en el sitio.
+void toLowerInPlace(char* text, std::size_t size);
+
+/// Convierte a mayúsculas size bytes de text, en el sitio.
+void toUpperInPlace(char* text, std::size_t size);
+
+inline void toLowerInPlace(std::string& text) { toLowerInPlace(text.data(), text.size()); }
+inline void toUpperInPlace(std::string& text) { toUpperInPlace(text.data(), text.size()); }
+
+/// Copia de text en minúsculas.
+std::string toLower(std::string_view text);
+
+/// Copia de text en mayúsculas.
+std::string toUpper(std::string_view text);
+
+/**
+ * @brief Compara sin distinguir mayúsculas.
+ * @return <0, 0 o >0, como std::string_view::compare.
+ */
+int compareIgnoreCase(std::string_view a, std::string_view b);
+
+/// Igualdad sin distinguir mayúsculas.
+bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
+/// Hash coherente con equalsIgnoreCase: "Alex" y "ALEX" dan el mismo valor.
+std::size_t hashIgnoreCase(std::string_view text);
+
+/// Comparador para std::sort, std::map, std::set...
+struct LessIgnoreCase {
+    bool operator()(std::string_view a, std::string_view b) const { return compareIgnoreCase(a, b) < 0; }
+};
+
+/// Igualdad para std::unique, std::unordered_map...
+struct EqualIgnoreCase {
+    bool operator()(std::string_view a, std::string_view b) const { return equalsIgnoreCase(a, b); }
+};
+
+/// Hash para std::unordered_map / std::unordered_set.
+struct HashIgnoreCase {
+    std::size_t operator()(std::string_view text) const { return hashIgnoreCase(text); }
+};
+
+} // namespace ascii_case
+
+#endif // ASCII_CASE_H
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <locale>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ascii_case.h"
+
+// ----------------------------
+// Benchmark: plegado de mayúsculas y ordenación sin distinguir mayúsculas
+// ----------------------------
+// 1. toLower sobre un texto grande: bucle con std::tolower frente a ascii_case.
+// 2. Ordenar millones de nombres: comparador con std::tolower, comparación
+//    por collate de la locale del sistema y ascii_case (escalar y AVX2).
+
+namespace {
+
+volatile std::size_t sink{};
+
+template <typename F>
+double measureMs(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+bool lessToLower(std::string_view a, std::string_view b) {
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+        return std::tolower(static_cast<unsigned char>(x)) < std::tolower(static_cast<unsigned char>(y));
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t nameCount = 2'000'000;
+    if (argc > 1) nameCount = std::strtoull(argv[1], nullptr, 10);
+
+    std::mt19937 rng{11};
+
+    // 1. Plegado de un texto de 64 MB
+    std::string text(64u << 20, ' ');
+    for (char& c : text) c = static_cast<char>(' ' + rng() % 95);
+    std::string copy{text};
+
+    std::cout << "toLower de " << (text.size() >> 20) << " MB\n";
+    const double tolowerMs = measureMs([&] {
+        for (char& c : copy) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    std::cout << "  std::tolower          " << std::fixed << std::setprecision(2)
+              << text.size() / tolowerMs / 1e6 << " GB/s\n";
+    for (ascii_case::Kernel kernel : {ascii_case::Kernel::Scalar, ascii_case::Kernel::Avx2}) {
+        if (!ascii_case::forceKernel(kernel)) continue;
+        copy = text;
+        const double ms = measureMs([&] { ascii_case::toLowerInPlace(copy); });
+        std::cout << "  ascii_case " << std::left << std::setw(10) << ascii_case::kernelName(kernel) << std::right
+                  << ' ' << text.size() / ms / 1e6 << " GB/s\n";
+    }
+
+    // 2. Ordenación de nombres con mayúsculas mezcladas
+    const char* firstNames[] = {"alex", "Alex", "ALEX", "john", "John", "peach", "Peach", "maria", "Maria"};
+    std::vector<std::string> storage(nameCount);
+    for (std::string& name : storage) {
+        name = firstNames[rng() % 9];
+        name += ' ';
+        name += std::to_string(rng() % 1'000'000);
+        if (rng() % 4 == 0) name += " de la Fuente Rodríguez"; // algunos nombres largos
+    }
+    const std::vector<std::string_view> names(storage.begin(), storage.end());
+
+    std::cout << "\nOrdenar " << nameCount << " nombres sin distinguir mayúsculas\n";
+    auto sortWith = [&](std::string_view label, auto less) {
+        std::vector<std::string_view> work{names};
+        const double ms = measureMs([&] { std::sort(work.begin(), work.end(), less); });
+        std::cout << "  " << std::left << std::setw(22) << label << std::right << std::setw(10) << ms << " ms\n";
+        sink = work.front().size();
+    };
+
+    sortWith("std::tolower", lessToLower);
+
+    std::locale locale{};
+    try {
+        locale = std::locale{""};
+    } catch (const std::runtime_error&) {
+        // Sin locale del sistema configurada: se queda la "C".
+    }
+    const auto& collate = std::use_facet<std::collate<char>>(locale);
+    sortWith("std::collate (" + locale.name() + ")", [&](std::string_view a, std::string_view b) {
+        return collate.compare(a.data(), a.data() + a.size(), b.data(), b.data() + b.size()) < 0;
+    });
+
+    for (ascii_case::Kernel kernel : {ascii_case::Kernel::Scalar, ascii_case::Kernel::Avx2}) {
+        if (!ascii_case::forceKernel(kernel)) continue;
+        sortWith(std::string{"ascii_case "} + ascii_case::kernelName(kernel), ascii_case::LessIgnoreCase{});
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "ascii_case.h"
+
+int main() {
+    std::cout << "Kernel en uso: " << ascii_case::kernelName(ascii_case::activeKernel()) << '\n';
+
+    // firstAlphabetical de 8.1-std_view2.cpp, pero sin distinguir mayúsculas.
+    auto firstAlphabetical = [](std::string_view s1, std::string_view s2) -> std::string_view {
+        return (ascii_case::compareIgnoreCase(s1, s2) <= 0) ? s1 : s2;
+    };
+    std::cout << "First alphabetical: " << firstAlphabetical("alex", "Bob") << '\n'; // con operator< saldría "Bob"
+
+    // Ordenar y quitar duplicados sin distinguir mayúsculas.
+    std::vector<std::string_view> names{"john", "Alex", "JOHN", "alex", "Peach", "bob"};
+    std::stable_sort(names.begin(), names.end(), ascii_case::LessIgnoreCase{});
+    names.erase(std::unique(names.begin(), names.end(), ascii_case::EqualIgnoreCase{}), names.end());
+    for (std::string_view name : names) std::cout << name << ' ';
+    std::cout << '\n';
+
+    // Conjunto que considera iguales "Alex" y "ALEX".
+    std::unordered_set<std::string_view, ascii_case::HashIgnoreCase, ascii_case::EqualIgnoreCase> seen{"Alex"};
+    std::cout << std::boolalpha << "¿Está ALEX? " << (seen.count("ALEX") == 1) << '\n';
+
+    std::string shout{"Hello, World! ñ"};
+    ascii_case::toUpperInPlace(shout); // la ñ (UTF-8) no se toca
+    std::cout << shout << " / " << ascii_case::toLower(shout) << '\n';
+
+    return 0;
+}
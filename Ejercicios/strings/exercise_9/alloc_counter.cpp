@@ -0,0 +1,175 @@
+#include "alloc_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// ----------------------------
+// Contadores
+// ----------------------------
+// Por hilo: variables thread_local triviales (sin constructor), así no
+// reservan memoria al crearse y no hay recursión dentro de operator new.
+// liveBytes es con signo: un bloque puede liberarse en otro hilo.
+struct ThreadCounters {
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t bytesAllocated;
+    long long liveBytes;
+    long long peakBytes;
+};
+
+thread_local ThreadCounters threadCounters{};
+
+std::atomic<std::size_t> globalAllocations{0};
+std::atomic<std::size_t> globalDeallocations{0};
+std::atomic<std::size_t> globalBytes{0};
+std::atomic<long long> globalLiveBytes{0};
+std::atomic<long long> globalPeakBytes{0};
+
+void recordAllocation(std::size_t size) {
+    ThreadCounters& local = threadCounters;
+    ++local.allocations;
+    local.bytesAllocated += size;
+    local.liveBytes += static_cast<long long>(size);
+    local.peakBytes = std::max(local.peakBytes, local.liveBytes);
+
+    globalAllocations.fetch_add(1, std::memory_order_relaxed);
+    globalBytes.fetch_add(size, std::memory_order_relaxed);
+    const long long live = globalLiveBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed)
+                         + static_cast<long long>(size);
+    long long peak = globalPeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !globalPeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+}
+
+void recordDeallocation(std::size_t size) {
+    ThreadCounters& local = threadCounters;
+    ++local.deallocations;
+    local.liveBytes -= static_cast<long long>(size);
+
+    globalDeallocations.fetch_add(1, std::memory_order_relaxed);
+    globalLiveBytes.fetch_sub(static_cast<long long>(size), std::memory_order_relaxed);
+}
+
+// ----------------------------
+// Reserva con cabecera
+// ----------------------------
+// operator delete sin tamaño no dice cuántos bytes libera, así que delante
+// de cada bloque guardamos su tamaño y la distancia hasta el inicio real
+// del bloque de malloc (necesaria para los new con alineación extendida).
+struct Header {
+    std::size_t size;
+    std::size_t offset;
+};
+
+constexpr std::size_t headerSpace = 16; // mantiene la alineación de malloc
+static_assert(sizeof(Header) <= headerSpace, "la cabecera debe caber en headerSpace");
+
+void* allocate(std::size_t size, std::size_t alignment) {
+    if (alignment < headerSpace) alignment = headerSpace;
+    const std::size_t extra = headerSpace + (alignment > headerSpace ? alignment : 0);
+    // size + extra daría la vuelta y malloc devolvería un bloque diminuto.
+    if (size > SIZE_MAX - extra) return nullptr;
+
+    void* raw = std::malloc(size + extra);
+    if (raw == nullptr) return nullptr;
+
+    const auto rawAddress = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t userAddress = (rawAddress + headerSpace + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+    auto* header = reinterpret_cast<Header*>(userAddress - headerSpace);
+    header->size = size;
+    header->offset = userAddress - rawAddress;
+
+    recordAllocation(size);
+    return reinterpret_cast<void*>(userAddress);
+}
+
+void deallocate(void* pointer) {
+    if (pointer == nullptr) return;
+    const auto userAddress = reinterpret_cast<std::uintptr_t>(pointer);
+    const auto* header = reinterpret_cast<const Header*>(userAddress - headerSpace);
+    recordDeallocation(header->size);
+    std::free(reinterpret_cast<void*>(userAddress - header->offset));
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+    while (true) {
+        if (void* pointer = allocate(size, alignment)) return pointer;
+        // Igual que el operator new estándar: probar el new_handler o lanzar.
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc{};
+        handler();
+    }
+}
+
+} // namespace
+
+// ----------------------------
+// Sustitución de los operadores globales
+// ----------------------------
+void* operator new(std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
+
+// ----------------------------
+// API pública
+// ----------------------------
+AllocationStats threadAllocationStats() {
+    const ThreadCounters& local = threadCounters;
+    return AllocationStats{local.allocations, local.deallocations, local.bytesAllocated,
+                           static_cast<std::size_t>(std::max(0LL, local.peakBytes))};
+}
+
+AllocationStats globalAllocationStats() {
+    return AllocationStats{globalAllocations.load(std::memory_order_relaxed),
+                           globalDeallocations.load(std::memory_order_relaxed),
+                           globalBytes.load(std::memory_order_relaxed),
+                           static_cast<std::size_t>(std::max(0LL, globalPeakBytes.load(std::memory_order_relaxed)))};
+}
+
+// El probe reinicia el pico del hilo al nivel actual para medir solo su
+// ámbito, y al destruirse deja el pico exterior como estaba (o mayor).
+AllocationProbe::AllocationProbe()
+    : start_(threadAllocationStats()),
+      startLiveBytes_(threadCounters.liveBytes),
+      outerPeak_(threadCounters.peakBytes) {
+    threadCounters.peakBytes = threadCounters.liveBytes;
+}
+
+AllocationProbe::~AllocationProbe() {
+    threadCounters.peakBytes = std::max(threadCounters.peakBytes, outerPeak_);
+}
+
+AllocationStats AllocationProbe::stats() const {
+    const ThreadCounters& local = threadCounters;
+    const long long peakAboveStart = local.peakBytes - startLiveBytes_;
+    return AllocationStats{local.allocations - start_.allocations,
+                           local.deallocations - start_.deallocations,
+                           local.bytesAllocated - start_.bytesAllocated,
+                           static_cast<std::size_t>(std::max(0LL, peakAboveStart))};
+}
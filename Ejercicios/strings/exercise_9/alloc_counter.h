@@ -0,0 +1,61 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>
+
+/*
+ * Contador de reservas de memoria.
+ *
+ * alloc_counter.cpp sustituye los operator new / operator delete globales
+ * (todas sus variantes). Basta con compilarlo junto al programa: desde ese
+ * momento cada reserva dinámica queda contada, por hilo y en total.
+ *
+ * Uso típico:
+ *
+ *     AllocationProbe probe{};
+ *     std::string greeting = "Hello, " + fullName + "!";
+ *     AllocationStats stats = probe.stats(); // reservas hechas desde el probe
+ */
+
+/**
+ * @brief Cifras de memoria dinámica.
+ */
+struct AllocationStats {
+    std::size_t allocations{};   ///< Llamadas a operator new.
+    std::size_t deallocations{}; ///< Llamadas a operator delete (con puntero no nulo).
+    std::size_t bytesAllocated{};///< Bytes pedidos en total.
+    std::size_t peakBytes{};     ///< Máximo de bytes vivos a la vez (en un probe: por encima del inicio).
+};
+
+/// Cifras del hilo actual desde que empezó.
+AllocationStats threadAllocationStats();
+
+/// Cifras de todos los hilos juntos (peakBytes es el pico global del proceso).
+AllocationStats globalAllocationStats();
+
+/**
+ * @class AllocationProbe
+ * @brief Mide la memoria dinámica del hilo actual dentro de un ámbito (RAII).
+ *
+ * Los probes se pueden anidar: cada uno ve solo lo que ocurrió desde que se
+ * creó. Solo cuenta las reservas del hilo que lo creó, así que varios hilos
+ * pueden medir a la vez sin interferir.
+ */
+class AllocationProbe {
+public:
+    AllocationProbe();
+    ~AllocationProbe();
+
+    AllocationProbe(const AllocationProbe&) = delete;
+    AllocationProbe& operator=(const AllocationProbe&) = delete;
+
+    /// Cifras desde la creación del probe hasta ahora.
+    AllocationStats stats() const;
+
+private:
+    AllocationStats start_;
+    long long startLiveBytes_; // con signo: ver liveBytes en alloc_counter.cpp
+    long long outerPeak_;
+};
+
+#endif // ALLOC_COUNTER_H
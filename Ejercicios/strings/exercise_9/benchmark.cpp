@@ -0,0 +1,94 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "alloc_counter.h"
+
+// ----------------------------
+// Benchmark: coste real de los patrones del capítulo de strings
+// ----------------------------
+// Para cada patrón se muestran reservas/op, bytes/op y ns/op. Se usan un
+// nombre corto (cabe en el SSO) y uno largo (no cabe) porque el resultado
+// cambia por completo entre ambos.
+
+namespace {
+
+volatile std::size_t sink{};
+
+// noinline: si el compilador metiera la función dentro del bucle podría
+// eliminar la copia y no estaríamos midiendo el paso de parámetros.
+__attribute__((noinline)) std::size_t printByValue(std::string str) { return str.size(); }
+__attribute__((noinline)) std::size_t printByConstRef(const std::string& str) { return str.size(); }
+__attribute__((noinline)) std::size_t printSV(std::string_view str) { return str.size(); }
+
+__attribute__((noinline)) std::string getName(const std::string& name) { return name; }
+__attribute__((noinline)) std::string_view getNameView(const std::string& name) { return name; }
+
+template <typename F>
+void run(std::string_view label, F&& body) {
+    constexpr std::size_t iterations = 1'000'000;
+
+    AllocationProbe probe{};
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) sink = body();
+    const auto stop = std::chrono::steady_clock::now();
+    const AllocationStats stats{probe.stats()};
+
+    std::cout << std::left << std::setw(40) << label << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << static_cast<double>(stats.allocations) / iterations
+              << std::setw(12) << static_cast<double>(stats.bytesAllocated) / iterations
+              << std::setw(10) << std::chrono::duration<double, std::nano>(stop - start).count() / iterations << '\n';
+}
+
+void runPatterns(const std::string& fullName) {
+    run("printSV(std::string) por valor", [&] { return printByValue(fullName); });
+    run("printSV(const std::string&)", [&] { return printByConstRef(fullName); });
+    run("printSV(std::string_view)", [&] { return printSV(fullName); });
+    run("printSV(literal) por valor", [&] { return printByValue("Hello, compile-time world!"); });
+    run("printSV(literal) como string_view", [&] { return printSV("Hello, compile-time world!"); });
+    run("getName() -> std::string", [&] { return getName(fullName).size(); });
+    run("getName() -> std::string_view", [&] { return getNameView(fullName).size(); });
+    run("\"Hello, \" + fullName + \"!\"", [&] { return ("Hello, " + fullName + "!").size(); });
+    run("greeting con reserve + append", [&] {
+        std::string greeting{};
+        greeting.reserve(7 + fullName.size() + 1);
+        greeting.append("Hello, ").append(fullName).append("!");
+        return greeting.size();
+    });
+}
+
+} // namespace
+
+int main() {
+    for (const std::string fullName : {"Alex", "María José García Fernández"}) {
+        std::cout << "\nfullName = \"" << fullName << "\" (" << fullName.size() << " bytes)\n";
+        std::cout << std::left << std::setw(40) << "patrón" << std::right << std::setw(12) << "reservas/op"
+                  << std::setw(12) << "bytes/op" << std::setw(10) << "ns/op" << '\n';
+        runPatterns(fullName);
+    }
+
+    // Varios hilos midiendo a la vez: cada probe solo ve su propio hilo.
+    std::cout << "\n4 hilos construyendo saludos en paralelo\n";
+    std::vector<AllocationStats> perThread(4);
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < perThread.size(); ++t) {
+        threads.emplace_back([t, &perThread] {
+            AllocationProbe probe{};
+            const std::string fullName{"María José García Fernández"};
+            for (std::size_t i = 0; i < 100'000 * (t + 1); ++i) sink = ("Hello, " + fullName + "!").size();
+            perThread[t] = probe.stats();
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    for (std::size_t t = 0; t < perThread.size(); ++t) {
+        std::cout << "  hilo " << t << ": " << perThread[t].allocations << " reservas, pico "
+                  << perThread[t].peakBytes << " bytes\n";
+    }
+    const AllocationStats total{globalAllocationStats()};
+    std::cout << "  proceso: " << total.allocations << " reservas, " << total.deallocations << " liberaciones\n";
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "alloc_counter.h"
+
+namespace {
+
+void printStats(std::string_view label, const AllocationStats& stats) {
+    std::cout << label << ": " << stats.allocations << " reservas, "
+              << stats.bytesAllocated << " bytes, pico " << stats.peakBytes << " bytes\n";
+}
+
+std::size_t byValue(std::string text) { return text.size(); }
+std::size_t byView(std::string_view text) { return text.size(); }
+
+} // namespace
+
+int main() {
+    // Más largo que el SSO de std::string (15 caracteres en libstdc++).
+    const std::string fullName{"María José García Fernández"};
+
+    {
+        AllocationProbe probe{};
+        byValue(fullName); // copia -> reserva
+        printStats("std::string por valor", probe.stats());
+    }
+    {
+        AllocationProbe probe{};
+        byView(fullName); // solo puntero + longitud
+        printStats("std::string_view", probe.stats());
+    }
+    {
+        AllocationProbe probe{};
+        std::string greeting = "Hello, " + fullName + "!";
+        printStats("\"Hello, \" + fullName + \"!\"", probe.stats());
+    }
+
+    printStats("Total del proceso", globalAllocationStats());
+    return 0;
+}